@@ -143,6 +143,21 @@ void jbmc_parse_optionst::get_command_line_options(optionst &options)
     options.set_option("no-array-field-sensitivity", true);
   }
 
+  if(cmdline.isset("sparse-array-field-sensitivity"))
+    options.set_option("sparse-array-field-sensitivity", true);
+
+  if(cmdline.isset("symex-profile"))
+  {
+    if(cmdline.isset("paths"))
+    {
+      log.error() << "--symex-profile not supported with --paths"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option("symex-profile", cmdline.get_value("symex-profile"));
+  }
+
   if(cmdline.isset("show-symex-strategies"))
   {
     log.status() << show_path_strategies() << messaget::eom;
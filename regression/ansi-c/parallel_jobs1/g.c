@@ -0,0 +1,4 @@
+int g(int x)
+{
+  return 2 * x;
+}
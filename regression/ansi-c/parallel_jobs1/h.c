@@ -0,0 +1,4 @@
+int h(int x)
+{
+  return x * x - x;
+}
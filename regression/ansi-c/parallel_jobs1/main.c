@@ -0,0 +1,8 @@
+int f(int);
+int g(int);
+int h(int);
+
+int main()
+{
+  return f(1) + g(2) + h(3) == 12 ? 0 : 1;
+}
@@ -0,0 +1,6 @@
+#include "header.h"
+
+number f(struct pair p)
+{
+  return sum(p);
+}
@@ -0,0 +1,14 @@
+typedef int number;
+
+struct pair
+{
+  number first;
+  number second;
+};
+
+static inline number sum(struct pair p)
+{
+  return p.first + p.second;
+}
+
+number f(struct pair p);
@@ -0,0 +1,15 @@
+int x, y;
+
+void writer()
+{
+  x = 1;
+  y = 1;
+}
+
+int main()
+{
+  __CPROVER_ASYNC_1: writer();
+  if(y == 1)
+    __CPROVER_assert(x == 1, "message passing under SC");
+  return 0;
+}
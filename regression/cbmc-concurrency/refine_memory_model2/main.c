@@ -0,0 +1,15 @@
+int x, y;
+
+void writer()
+{
+  y = 1;
+  x = 1;
+}
+
+int main()
+{
+  __CPROVER_ASYNC_1: writer();
+  if(y == 1)
+    __CPROVER_assert(x == 1, "writes may be observed in between");
+  return 0;
+}
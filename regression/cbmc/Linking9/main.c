@@ -0,0 +1,25 @@
+#include <assert.h>
+
+#include "point.h"
+
+struct local
+{
+  int x;
+  int y;
+};
+
+extern int table[];
+char local_char(void);
+
+int main()
+{
+  struct point p = {1, 2};
+  struct local l = {3, 4};
+
+  assert(norm1(shift(p, 1)) == 5);
+  assert(l.x + l.y == 7);
+  assert(table[2] == 3);
+  assert(local_char() == 'c');
+
+  return 0;
+}
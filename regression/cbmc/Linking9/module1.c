@@ -0,0 +1,8 @@
+#include "point.h"
+
+int table[3] = {1, 2, 3};
+
+int norm1(struct point p)
+{
+  return (p.x < 0 ? -p.x : p.x) + (p.y < 0 ? -p.y : p.y);
+}
@@ -0,0 +1,18 @@
+#include "point.h"
+
+struct local
+{
+  char c;
+};
+
+struct point shift(struct point p, int by)
+{
+  struct point result = {p.x + by, p.y + by};
+  return result;
+}
+
+char local_char(void)
+{
+  struct local l = {'c'};
+  return l.c;
+}
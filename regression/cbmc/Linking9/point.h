@@ -0,0 +1,8 @@
+struct point
+{
+  int x;
+  int y;
+};
+
+int norm1(struct point p);
+struct point shift(struct point p, int by);
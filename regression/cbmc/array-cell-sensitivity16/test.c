@@ -0,0 +1,10 @@
+#include <assert.h>
+
+int main(int argc, char **argv)
+{
+  int array[100];
+  array[argc] = 1;
+  array[1] = argc;
+  assert(array[1] == argc);
+  assert(array[argc] == 1 || argc == 1);
+}
@@ -0,0 +1,8 @@
+int main()
+{
+  int x;
+  int a[4] = {1, 2, 3, 4};
+  __CPROVER_assume(x >= 0 && x < 4);
+  __CPROVER_assert(a[x] > 0, "positive");
+  return 0;
+}
@@ -0,0 +1,13 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+int main()
+{
+  char *s = malloc(4);
+  strcpy(s, "abc");
+  assert(strlen(s) == 3);
+  assert(strlen(s) == 4);
+  free(s);
+  return 0;
+}
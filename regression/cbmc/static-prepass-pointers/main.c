@@ -0,0 +1,9 @@
+int main(void)
+{
+  int x = 0;
+  int *p = &x;
+  *p = 1;
+  __CPROVER_assert(x == 0, "changed through a pointer");
+
+  return 0;
+}
@@ -0,0 +1,13 @@
+int x;
+
+int main(void)
+{
+  x = 0;
+
+__CPROVER_ASYNC_1:
+  x = 1;
+
+  __CPROVER_assert(x == 0, "written by another thread");
+
+  return 0;
+}
@@ -0,0 +1,13 @@
+int main(void)
+{
+  int a[10];
+
+  for(int i = 0; i < 10; ++i)
+    a[i] = i;
+
+  int x;
+  if(x > 0 && x < 10)
+    __CPROVER_assert(a[x] == x, "not known statically");
+
+  return 0;
+}
@@ -0,0 +1,26 @@
+#include <assert.h>
+
+int add_one(int x)
+{
+  int y = x;
+  y = y + 1;
+  return y;
+}
+
+int main(void)
+{
+  int a = 1;
+  int b = 2;
+  int c = a + b;
+
+  for(int i = 0; i < 3; ++i)
+    c = c + 0;
+
+  int d = add_one(c);
+
+  assert(a == 1);
+  assert(c == 3);
+  assert(d == 4);
+
+  return 0;
+}
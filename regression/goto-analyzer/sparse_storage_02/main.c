@@ -0,0 +1,8 @@
+#include <assert.h>
+
+int main(void)
+{
+  int a = 1;
+  assert(a == 1);
+  return 0;
+}
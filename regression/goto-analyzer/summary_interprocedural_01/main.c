@@ -0,0 +1,17 @@
+#include <assert.h>
+
+int add_one(int x)
+{
+  return x + 1;
+}
+
+int main(void)
+{
+  int a = add_one(1);
+  assert(a == 2);
+
+  int b = add_one(1);
+  assert(b == 2);
+
+  return 0;
+}
@@ -0,0 +1,17 @@
+#include <assert.h>
+
+int main(void)
+{
+  int x;
+  __CPROVER_assume(x >= 0 && x <= 100);
+
+  int y = x + 1;
+  assert(x < y);
+  assert(y < 50);
+
+  int z;
+  if(z < x)
+    assert(z < y);
+
+  return 0;
+}
@@ -0,0 +1,16 @@
+#include <assert.h>
+
+int main(void)
+{
+  int total = 0;
+
+  for(int i = 0; i < 100; ++i)
+  {
+    for(int j = 0; j < 10; ++j)
+      ++total;
+  }
+
+  assert(total >= 0);
+
+  return 0;
+}
@@ -0,0 +1,4 @@
+int f1(int x)
+{
+  return x - 1;
+}
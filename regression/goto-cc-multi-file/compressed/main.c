@@ -0,0 +1,6 @@
+int f1(int);
+
+int main()
+{
+  return f1(1);
+}
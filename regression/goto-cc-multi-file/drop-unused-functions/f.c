@@ -0,0 +1,24 @@
+int called(int x)
+{
+  return x;
+}
+
+int pointed_to(int x)
+{
+  return x + 1;
+}
+
+int unused(int x)
+{
+  return x + 2;
+}
+
+int kept(int x)
+{
+  return unused(x);
+}
+
+int never_called(int x)
+{
+  return x + 3;
+}
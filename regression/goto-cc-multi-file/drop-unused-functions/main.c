@@ -0,0 +1,9 @@
+int called(int);
+int pointed_to(int);
+
+int (*const table[])(int) = {pointed_to};
+
+int main()
+{
+  return called(1) + table[0](2);
+}
@@ -0,0 +1,20 @@
+int main()
+{
+  int x, y;
+  int c;
+
+  __CPROVER_set_must(&x, "taint");
+  if(c)
+  {
+    __CPROVER_set_may(&y, "taint");
+    __CPROVER_set_must(&y, "taint");
+  }
+
+  __CPROVER_assert(
+    __CPROVER_get_must(&x, "taint"), "x is tainted on both paths");
+  __CPROVER_assert(
+    !__CPROVER_get_must(&y, "taint"), "y is tainted on one path only");
+  __CPROVER_assert(__CPROVER_get_may(&y, "taint"), "y may be tainted");
+
+  return 0;
+}
@@ -0,0 +1,53 @@
+#!/usr/bin/env bash
+#
+# Run goto-cc or cbmc twice in the directory of a test, such that the second
+# run can use what the first run stored, e.g. in a cache. The arguments after
+# the paths of the tools name the tool to run, followed by its arguments and
+# the source file. Arguments after --second-run replace those before for the
+# second run. The directory `cache' is removed before the first run. Each line
+# of the output of the first run is prefixed with `first run: '.
+
+goto_cc=$1
+cbmc=$2
+is_windows=$3
+tool=$4
+
+args=("${@:5:$#-5}")
+name=${*:$#}
+
+first_args=()
+second_args=()
+is_second=false
+for arg in "${args[@]}"; do
+  if [[ "${arg}" == "--second-run" ]]; then
+    is_second=true
+  elif [[ "${is_second}" == "true" ]]; then
+    second_args+=("${arg}")
+  else
+    first_args+=("${arg}")
+  fi
+done
+
+if [[ "${is_second}" != "true" ]]; then
+  second_args=("${first_args[@]}")
+fi
+
+run()
+{
+  if [[ "${tool}" == "goto-cc" ]]; then
+    if [[ "${is_windows}" == "true" ]]; then
+      "${goto_cc}" "${name}" "$@" "/Fe${name%.c}.gb"
+    else
+      "${goto_cc}" "${name}" "$@" -o "${name%.c}.gb"
+    fi
+  else
+    "${cbmc}" "${name}" "$@"
+  fi
+}
+
+rm -rf cache
+
+run "${first_args[@]}" 2>&1 | sed 's/^/first run: /'
+echo "first run: EXIT=${PIPESTATUS[0]}"
+
+run "${second_args[@]}"
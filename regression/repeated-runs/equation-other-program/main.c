@@ -0,0 +1,11 @@
+int main()
+{
+  int x;
+#ifdef OTHER
+  __CPROVER_assume(x > 0);
+#else
+  __CPROVER_assume(x >= 0);
+#endif
+  __CPROVER_assert(x > 0, "positive");
+  return 0;
+}
@@ -0,0 +1,15 @@
+int square(int x)
+{
+  return x * x;
+}
+
+int main(void)
+{
+  int a = 3;
+  int b = square(a);
+
+  __CPROVER_assert(a == 3, "a is unchanged");
+  __CPROVER_assert(b >= 0, "squares are not negative");
+
+  return 0;
+}
@@ -0,0 +1,22 @@
+struct bytes
+{
+#ifdef SHIFTED
+  unsigned char padding;
+#endif
+  unsigned char low;
+};
+
+union word
+{
+  unsigned int value;
+  struct bytes bytes;
+};
+
+int main(void)
+{
+  union word w;
+  w.value = 1;
+  __CPROVER_assert(w.bytes.low == 1, "the low byte comes first");
+
+  return 0;
+}
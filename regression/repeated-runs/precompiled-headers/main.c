@@ -0,0 +1,8 @@
+#include "header.h"
+
+int main()
+{
+  struct pair p = {1, 2};
+  number n = f(p);
+  return n == 3 ? 0 : 1;
+}
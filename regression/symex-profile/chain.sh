@@ -0,0 +1,23 @@
+#!/bin/bash
+
+cbmc=$1
+
+name=${*:$#}
+args=${*:2:$#-2}
+
+profile=
+previous=
+for arg in ${args}; do
+  if [[ "${previous}" == "--symex-profile" ]]; then
+    profile=${arg}
+  fi
+  previous=${arg}
+done
+
+rm -f "${profile}"
+$cbmc ${name} ${args}
+CBMC_RETURN_CODE="$?"
+if [[ -f "${profile}" ]]; then
+  cat "${profile}"
+fi
+exit ${CBMC_RETURN_CODE}
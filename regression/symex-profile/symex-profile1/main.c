@@ -0,0 +1,14 @@
+int f(int x)
+{
+  return x + 1;
+}
+
+int main()
+{
+  int a[3];
+  int *p = a;
+  for(int i = 0; i < 3; ++i)
+    p[i] = f(i);
+  __CPROVER_assert(a[2] == 3, "a[2] == 3");
+  return 0;
+}
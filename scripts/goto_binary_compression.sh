@@ -0,0 +1,54 @@
+#!/bin/bash
+
+# Compare the size of goto binaries and the time it takes to load them when
+# they are written with and without --compress-goto-binaries. Each test of a
+# regression directory that has a main.c is compiled both ways.
+#
+# Usage: scripts/goto_binary_compression.sh [regression directory]
+# The tools are taken from src/ of the build tree, unless GOTO_CC and
+# GOTO_INSTRUMENT are set.
+
+set -e
+
+directory=${1:-regression/cbmc}
+goto_cc=${GOTO_CC:-src/goto-cc/goto-cc}
+goto_instrument=${GOTO_INSTRUMENT:-src/goto-instrument/goto-instrument}
+
+work_dir=$(mktemp -d)
+
+cleanup()
+{
+  rm -rf "$work_dir"
+}
+
+trap cleanup EXIT
+
+mkdir "$work_dir/plain" "$work_dir/compressed"
+
+tests=0
+for test in "$directory"/*/main.c
+do
+  name=$(basename "$(dirname "$test")")
+  if "$goto_cc" "$test" -o "$work_dir/plain/$name.gb" 2>/dev/null &&
+    "$goto_cc" --compress-goto-binaries "$test" \
+      -o "$work_dir/compressed/$name.gb" 2>/dev/null
+  then
+    tests=$((tests + 1))
+  else
+    rm -f "$work_dir/plain/$name.gb" "$work_dir/compressed/$name.gb"
+  fi
+done
+
+echo "goto binaries: $tests"
+
+for kind in plain compressed
+do
+  size=$(cat "$work_dir/$kind"/*.gb | wc -c)
+  start=$(date +%s.%N)
+  for binary in "$work_dir/$kind"/*.gb
+  do
+    "$goto_instrument" --count-eloc "$binary" > /dev/null
+  done
+  end=$(date +%s.%N)
+  echo "$kind: $size bytes, loaded in $(echo "$end - $start" | bc) s"
+done
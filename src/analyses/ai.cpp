@@ -208,9 +208,8 @@ ai_baset::trace_ptrt ai_baset::get_next(working_sett &working_set)
   PRECONDITION(!working_set.empty());
 
   static_assert(
-    std::is_same<
-      working_sett,
-      std::set<trace_ptrt, ai_history_baset::compare_historyt>>::value,
+    std::is_same<working_sett, std::set<trace_ptrt, working_set_ordert>>::
+      value,
     "begin must return the minimal entry");
   auto first = working_set.begin();
 
@@ -230,7 +229,7 @@ bool ai_baset::fixedpoint(
 {
   PRECONDITION(start_trace != nullptr);
 
-  working_sett working_set;
+  working_sett working_set = make_working_set();
   put_in_working_set(working_set, start_trace);
 
   bool new_data=false;
@@ -238,10 +237,13 @@ bool ai_baset::fixedpoint(
   while(!working_set.empty())
   {
     trace_ptrt p = get_next(working_set);
+    ++iteration_count;
 
     // goto_program is really only needed for iterator manipulation
     if(visit(function_id, p, working_set, goto_program, goto_functions, ns))
       new_data=true;
+
+    storage->prune(p);
   }
 
   return new_data;
@@ -550,7 +552,8 @@ bool ai_recursive_interproceduralt::visit_edge_function_call(
   {
     locationt l_begin = callee.instructions.begin();
 
-    working_sett catch_working_set; // The trace from the next fixpoint
+    // The trace from the next fixpoint
+    working_sett catch_working_set = make_working_set();
 
     // Do the edge from the call site to the beginning of the function
     bool new_data = visit_edge(
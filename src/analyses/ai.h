@@ -46,7 +46,9 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_ANALYSES_AI_H
 
 #include <iosfwd>
+#include <limits>
 #include <memory>
+#include <set>
 
 #include <util/deprecate.h>
 #include <util/json.h>
@@ -60,6 +62,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "ai_history.h"
 #include "ai_storage.h"
 #include "is_threaded.h"
+#include "weak_topological_order.h"
 
 /// This is the basic interface of the abstract interpreter with default
 /// implementations of the core functionality.
@@ -267,6 +270,22 @@ class ai_baset
   virtual void clear()
   {
     storage->clear();
+    iteration_count = 0;
+  }
+
+  /// Process the work queue in the order given by \p order rather than by
+  /// location number. Instructions that are not part of \p order are
+  /// processed last.
+  void set_iteration_order(std::shared_ptr<const weak_topological_ordert> order)
+  {
+    iteration_order = std::move(order);
+  }
+
+  /// \return the number of abstract transformers applied, counting each
+  ///   instruction once per visit
+  std::size_t get_iteration_count() const
+  {
+    return iteration_count;
   }
 
   /// Output the abstract states for a single function
@@ -412,8 +431,43 @@ class ai_baset
     const irep_idt &function_id,
     const goto_programt &goto_program) const;
 
-  /// The work queue, sorted using the history's ordering operator
-  typedef trace_sett working_sett;
+  /// Orders the work queue by the position of the histories' locations in a
+  /// weak topological ordering, if one has been set, and otherwise using the
+  /// history's ordering operator
+  struct working_set_ordert
+  {
+    const weak_topological_ordert *order = nullptr;
+
+    bool operator()(const trace_ptrt &l, const trace_ptrt &r) const
+    {
+      if(order != nullptr)
+      {
+        const std::size_t l_position = position(l);
+        const std::size_t r_position = position(r);
+        if(l_position != r_position)
+          return l_position < r_position;
+      }
+      return *l < *r;
+    }
+
+    std::size_t position(const trace_ptrt &t) const
+    {
+      const locationt &l = t->current_location();
+      return order->contains(l) ? order->position(l)
+                                : std::numeric_limits<std::size_t>::max();
+    }
+  };
+
+  /// The work queue
+  typedef std::set<trace_ptrt, working_set_ordert> working_sett;
+
+  /// Create an empty work queue using the iteration order of this analysis
+  working_sett make_working_set() const
+  {
+    working_set_ordert ordering;
+    ordering.order = iteration_order.get();
+    return working_sett(ordering);
+  }
 
   /// Get the next location from the work queue
   trace_ptrt get_next(working_sett &working_set);
@@ -492,6 +546,12 @@ class ai_baset
   /// For creating history objects
   std::unique_ptr<ai_history_factory_baset> history_factory;
 
+  /// If set, the work queue is processed in this order
+  std::shared_ptr<const weak_topological_ordert> iteration_order;
+
+  /// Number of entries taken from the work queue
+  std::size_t iteration_count = 0;
+
   /// For creating domain objects
   std::unique_ptr<ai_domain_factory_baset> domain_factory;
 
@@ -743,7 +803,7 @@ class concurrency_aware_ait:public ait<domainT>
 
       for(const auto &wl_entry : thread_wl)
       {
-        working_sett working_set;
+        working_sett working_set = ai_baset::make_working_set();
         ai_baset::trace_ptrt t(
           ai_baset::history_factory->epoch(wl_entry.location));
         ai_baset::put_in_working_set(working_set, t);
@@ -754,6 +814,7 @@ class concurrency_aware_ait:public ait<domainT>
         while(!working_set.empty())
         {
           ai_baset::trace_ptrt p = ai_baset::get_next(working_set);
+          ++ai_baset::iteration_count;
           goto_programt::const_targett l = p->current_location();
 
           ai_baset::visit(
@@ -92,6 +92,14 @@ class ai_storage_baset
   {
     return;
   }
+
+  /// Notifies the storage that the abstract interpreter has computed all
+  /// successors of the domain for history \p p. Storage that can recompute
+  /// domains may discard it.
+  virtual void prune(trace_ptrt p)
+  {
+    return;
+  }
 };
 
 // There are a number of options for how to store the history objects.
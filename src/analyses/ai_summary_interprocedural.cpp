@@ -0,0 +1,220 @@
+/*******************************************************************\
+
+Module: Abstract Interpretation with Function Summaries
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// An abstract interpreter that caches input / output summaries of functions
+
+#include "ai_summary_interprocedural.h"
+
+#include "call_graph.h"
+
+bool ai_summary_interproceduralt::visit_edge_function_call(
+  const irep_idt &calling_function_id,
+  trace_ptrt p_call,
+  locationt l_return,
+  const irep_idt &callee_function_id,
+  working_sett &working_set,
+  const goto_programt &callee,
+  const goto_functionst &goto_functions,
+  const namespacet &ns)
+{
+  if(!recursive_functions_computed)
+    compute_recursive_functions(goto_functions);
+
+  if(recursive_functions.count(callee_function_id) != 0)
+  {
+    return ai_recursive_interproceduralt::visit_edge_function_call(
+      calling_function_id,
+      p_call,
+      l_return,
+      callee_function_id,
+      working_set,
+      callee,
+      goto_functions,
+      ns);
+  }
+
+  messaget log(message_handler);
+  log.progress() << "ai_summary_interproceduralt::visit_edge_function_call"
+                 << " from " << p_call->current_location()->location_number
+                 << " to " << l_return->location_number << messaget::eom;
+
+  locationt l_begin = callee.instructions.begin();
+  locationt l_end = --callee.instructions.end();
+  DATA_INVARIANT(
+    l_end->is_end_function(),
+    "The last instruction of a goto_program must be END_FUNCTION");
+
+  auto begin_step = p_call->step(
+    l_begin,
+    *(storage->abstract_traces_before(l_begin)),
+    ai_history_baset::no_caller_history);
+  if(begin_step.first == ai_history_baset::step_statust::BLOCKED)
+    return false;
+  trace_ptrt p_begin = begin_step.second;
+
+  // The history of the return site does not depend on the callee, so it can
+  // be computed as if the call were skipped.
+  auto return_step = p_call->step(
+    l_return,
+    *(storage->abstract_traces_before(l_return)),
+    ai_history_baset::no_caller_history);
+  if(return_step.first == ai_history_baset::step_statust::BLOCKED)
+    return false;
+  trace_ptrt p_return = return_step.second;
+
+  std::unique_ptr<statet> input = make_temporary_state(get_state(p_call));
+  input->transform(
+    calling_function_id, p_call, callee_function_id, p_begin, *this, ns);
+  if(input->is_bottom())
+    return false;
+
+  std::vector<summaryt> &function_summaries = summaries[callee_function_id];
+  const summaryt *summary = nullptr;
+  for(const auto &s : function_summaries)
+  {
+    if(equal_states(*s.input, *input, p_call, p_begin))
+    {
+      summary = &s;
+      break;
+    }
+  }
+
+  if(summary != nullptr)
+  {
+    log.progress() << "Reuse summary of " << callee_function_id
+                   << messaget::eom;
+    ++summaries_reused;
+  }
+  else
+  {
+    log.progress() << "Compute summary of " << callee_function_id
+                   << messaget::eom;
+
+    // The trace from the next fixpoint
+    working_sett catch_working_set = make_working_set();
+
+    if(visit_edge(
+         calling_function_id,
+         p_call,
+         callee_function_id,
+         l_begin,
+         ai_history_baset::no_caller_history,
+         ns,
+         catch_working_set))
+    {
+      fixedpoint(
+        get_next(catch_working_set),
+        callee_function_id,
+        callee,
+        goto_functions,
+        ns);
+    }
+
+    // Join the states at the end of the callee that can return to the call
+    // site. The storage may contain states of other calls as well, which
+    // makes the output less precise but still sound. The return edge is not
+    // part of the summary, as it depends on the call site.
+    summaryt summary_of_call{std::move(input), nullptr, nullptr};
+    for(const auto &p_end : *(storage->abstract_traces_before(l_end)))
+    {
+      const statet &end_state = get_state(p_end);
+      if(end_state.is_bottom())
+        continue;
+
+      auto end_step = p_end->step(
+        l_return, *(storage->abstract_traces_before(l_return)), p_call);
+      if(end_step.first == ai_history_baset::step_statust::BLOCKED)
+        continue;
+
+      if(summary_of_call.output == nullptr)
+      {
+        summary_of_call.output = domain_factory->copy(end_state);
+        summary_of_call.p_end = p_end;
+      }
+      else
+      {
+        domain_factory->merge(
+          *summary_of_call.output, end_state, p_end, summary_of_call.p_end);
+      }
+    }
+
+    function_summaries.push_back(std::move(summary_of_call));
+    summary = &function_summaries.back();
+    ++summaries_computed;
+  }
+
+  // The callee does not return
+  if(summary->output == nullptr || summary->output->is_bottom())
+    return false;
+
+  std::unique_ptr<statet> returned = make_temporary_state(*summary->output);
+  returned->transform(
+    callee_function_id,
+    summary->p_end,
+    calling_function_id,
+    p_return,
+    *this,
+    ns);
+
+  if(
+    merge(*returned, summary->p_end, p_return) ||
+    return_step.first == ai_history_baset::step_statust::NEW)
+  {
+    put_in_working_set(working_set, p_return);
+    return true;
+  }
+
+  return false;
+}
+
+void ai_summary_interproceduralt::finalize()
+{
+  ai_recursive_interproceduralt::finalize();
+
+  messaget log(message_handler);
+  log.statistics() << "Function summaries: " << summaries_computed
+                   << " computed, " << summaries_reused << " reused"
+                   << messaget::eom;
+}
+
+void ai_summary_interproceduralt::compute_recursive_functions(
+  const goto_functionst &goto_functions)
+{
+  const call_grapht::directed_grapht call_graph =
+    call_grapht(goto_functions).get_directed_graph();
+
+  std::vector<call_grapht::directed_grapht::node_indext> scc_numbers;
+  const std::size_t number_of_sccs = call_graph.SCCs(scc_numbers);
+
+  std::vector<std::size_t> scc_sizes(number_of_sccs, 0);
+  for(const auto scc_number : scc_numbers)
+    ++scc_sizes[scc_number];
+
+  for(std::size_t i = 0; i < call_graph.size(); ++i)
+  {
+    if(scc_sizes[scc_numbers[i]] > 1 || call_graph.has_edge(i, i))
+      recursive_functions.insert(call_graph[i].function);
+  }
+
+  recursive_functions_computed = true;
+}
+
+bool ai_summary_interproceduralt::equal_states(
+  const statet &a,
+  const statet &b,
+  trace_ptrt from,
+  trace_ptrt to) const
+{
+  std::unique_ptr<statet> a_copy = domain_factory->copy(a);
+  if(domain_factory->merge(*a_copy, b, from, to))
+    return false;
+
+  std::unique_ptr<statet> b_copy = domain_factory->copy(b);
+  return !domain_factory->merge(*b_copy, a, from, to);
+}
@@ -0,0 +1,112 @@
+/*******************************************************************\
+
+Module: Abstract Interpretation with Function Summaries
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// An abstract interpreter that, like ai_recursive_interproceduralt, analyses
+/// callees when they are called, but caches the effect of each call as an
+/// input / output summary of the callee. Later calls with the same input
+/// state reuse the summary rather than walking the callee's body again.
+
+#ifndef CPROVER_ANALYSES_AI_SUMMARY_INTERPROCEDURAL_H
+#define CPROVER_ANALYSES_AI_SUMMARY_INTERPROCEDURAL_H
+
+#include "ai.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+/// Summaries are only used for functions that are not part of a recursive
+/// strongly connected component of the call graph; calls to recursive
+/// functions are handled as in ai_recursive_interproceduralt. A function's
+/// summary is complete when its analysis returns, so the summaries of callees
+/// are computed before those of their callers.
+///
+/// The input of a summary is the state at the start of the callee, the output
+/// is the join of the states at its END_FUNCTION that can return to the call
+/// site. The return edge is applied to the output at each call site. The
+/// locations in the callee are not analysed again when a summary is reused.
+/// As their input is the same, the states stored for them already cover the
+/// new call, although context-sensitive histories will not have a separate
+/// history for it.
+///
+/// There is no separate pass over the SCCs from the leaves up. The input of
+/// a summary is only known once the caller has been analysed up to the
+/// call, so summaries can only be computed when their callers need them.
+/// Nor are SCCs analysed in parallel, as the reference counting of irept and
+/// the string table are not thread-safe.
+class ai_summary_interproceduralt : public ai_recursive_interproceduralt
+{
+public:
+  ai_summary_interproceduralt(
+    std::unique_ptr<ai_history_factory_baset> &&hf,
+    std::unique_ptr<ai_domain_factory_baset> &&df,
+    std::unique_ptr<ai_storage_baset> &&st,
+    message_handlert &mh)
+    : ai_recursive_interproceduralt(
+        std::move(hf),
+        std::move(df),
+        std::move(st),
+        mh)
+  {
+  }
+
+  void clear() override
+  {
+    ai_recursive_interproceduralt::clear();
+    summaries.clear();
+    recursive_functions_computed = false;
+    recursive_functions.clear();
+    summaries_computed = 0;
+    summaries_reused = 0;
+  }
+
+protected:
+  bool visit_edge_function_call(
+    const irep_idt &calling_function_id,
+    trace_ptrt p_call,
+    locationt l_return,
+    const irep_idt &callee_function_id,
+    working_sett &working_set,
+    const goto_programt &callee,
+    const goto_functionst &goto_functions,
+    const namespacet &ns) override;
+
+  void finalize() override;
+
+  struct summaryt
+  {
+    /// The state at the start of the callee
+    std::unique_ptr<statet> input;
+    /// The join of the states at the END_FUNCTION of the callee, before the
+    /// return edge, which is applied for each call site
+    std::unique_ptr<statet> output;
+    /// A trace at the END_FUNCTION of the callee, used as the origin of the
+    /// return edge
+    trace_ptrt p_end;
+  };
+
+  /// Summaries of each function, in the order they were computed
+  std::unordered_map<irep_idt, std::vector<summaryt>> summaries;
+
+  /// Functions that are part of a cycle in the call graph
+  std::unordered_set<irep_idt> recursive_functions;
+  bool recursive_functions_computed = false;
+
+  void compute_recursive_functions(const goto_functionst &goto_functions);
+
+  /// \return true if \p a and \p b are equal, as determined by merging each
+  ///   into a copy of the other
+  bool
+  equal_states(const statet &a, const statet &b, trace_ptrt from, trace_ptrt to)
+    const;
+
+  std::size_t summaries_computed = 0;
+  std::size_t summaries_reused = 0;
+};
+
+#endif // CPROVER_ANALYSES_AI_SUMMARY_INTERPROCEDURAL_H
@@ -0,0 +1,260 @@
+/*******************************************************************\
+
+Module: Function Call Graph Index
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// A compact, read-only call graph that answers reachability queries quickly
+
+#include "call_graph_index.h"
+
+#include "call_graph.h"
+
+#include <algorithm>
+#include <limits>
+
+/// Build compressed sparse rows from the sorted, duplicate-free list of pairs
+/// \p pairs, where the first element of each pair is the row, which must be
+/// less than \p rows
+static void build_rows(
+  const std::vector<std::pair<std::size_t, std::size_t>> &pairs,
+  std::size_t rows,
+  std::vector<std::size_t> &offsets,
+  std::vector<std::size_t> &columns)
+{
+  offsets.assign(rows + 1, 0);
+  for(const auto &pair : pairs)
+    ++offsets[pair.first + 1];
+  for(std::size_t row = 0; row < rows; ++row)
+    offsets[row + 1] += offsets[row];
+
+  columns.clear();
+  columns.reserve(pairs.size());
+  for(const auto &pair : pairs)
+    columns.push_back(pair.second);
+}
+
+call_graph_indext::call_graph_indext(const call_grapht &call_graph)
+{
+  functions.assign(call_graph.nodes.begin(), call_graph.nodes.end());
+  for(const auto &edge : call_graph.edges)
+  {
+    if(call_graph.nodes.count(edge.first) == 0)
+      functions.push_back(edge.first);
+    if(call_graph.nodes.count(edge.second) == 0)
+      functions.push_back(edge.second);
+  }
+
+  // number the functions by name, such that the numbering does not depend on
+  // the order of the unordered set of nodes
+  std::sort(
+    functions.begin(),
+    functions.end(),
+    [](const irep_idt &a, const irep_idt &b) {
+      return id2string(a) < id2string(b);
+    });
+  functions.erase(
+    std::unique(functions.begin(), functions.end()), functions.end());
+
+  ids.reserve(functions.size());
+  for(function_idt id = 0; id < functions.size(); ++id)
+    ids.emplace(functions[id], id);
+
+  std::vector<std::pair<function_idt, function_idt>> calls;
+  calls.reserve(call_graph.edges.size());
+  for(const auto &edge : call_graph.edges)
+    calls.emplace_back(ids.at(edge.first), ids.at(edge.second));
+  std::sort(calls.begin(), calls.end());
+  calls.erase(std::unique(calls.begin(), calls.end()), calls.end());
+
+  build_rows(calls, functions.size(), callee_offsets, callee_ids);
+
+  for(auto &call : calls)
+    std::swap(call.first, call.second);
+  std::sort(calls.begin(), calls.end());
+  build_rows(calls, functions.size(), caller_offsets, caller_ids);
+
+  compute_components();
+}
+
+/// Compute the strongly connected components with Tarjan's algorithm, which
+/// completes each component after all the components that it reaches, and
+/// thus numbers them in reverse topological order
+void call_graph_indext::compute_components()
+{
+  const std::size_t unvisited = std::numeric_limits<std::size_t>::max();
+
+  std::vector<std::size_t> index(size(), unvisited);
+  std::vector<std::size_t> lowlink(size());
+  std::vector<bool> on_stack(size(), false);
+  std::vector<function_idt> stack;
+  std::size_t next_index = 0;
+
+  // the functions being visited, each with the position of the next callee
+  std::vector<std::pair<function_idt, std::size_t>> work;
+
+  components.assign(size(), 0);
+  recursive_components.clear();
+
+  const auto visit = [&](function_idt id) {
+    index[id] = lowlink[id] = next_index++;
+    stack.push_back(id);
+    on_stack[id] = true;
+    work.emplace_back(id, callee_offsets[id]);
+  };
+
+  for(function_idt root = 0; root < size(); ++root)
+  {
+    if(index[root] != unvisited)
+      continue;
+
+    visit(root);
+
+    while(!work.empty())
+    {
+      const function_idt id = work.back().first;
+
+      if(work.back().second < callee_offsets[id + 1])
+      {
+        const function_idt callee = callee_ids[work.back().second++];
+        if(index[callee] == unvisited)
+          visit(callee);
+        else if(on_stack[callee])
+          lowlink[id] = std::min(lowlink[id], index[callee]);
+        continue;
+      }
+
+      if(lowlink[id] == index[id])
+      {
+        const std::size_t component = recursive_components.size();
+        bool recursive = false;
+        function_idt member;
+        do
+        {
+          member = stack.back();
+          stack.pop_back();
+          on_stack[member] = false;
+          components[member] = component;
+          recursive |= member != id;
+        } while(member != id);
+
+        recursive_components.push_back(recursive);
+      }
+
+      work.pop_back();
+      if(!work.empty())
+      {
+        const function_idt caller = work.back().first;
+        lowlink[caller] = std::min(lowlink[caller], lowlink[id]);
+      }
+    }
+  }
+
+  std::vector<std::pair<std::size_t, std::size_t>> component_calls;
+  for(function_idt id = 0; id < size(); ++id)
+  {
+    for(const function_idt callee : callees(id))
+    {
+      if(callee == id)
+        recursive_components[components[id]] = true;
+      else if(components[callee] != components[id])
+        component_calls.emplace_back(components[id], components[callee]);
+    }
+  }
+
+  std::sort(component_calls.begin(), component_calls.end());
+  component_calls.erase(
+    std::unique(component_calls.begin(), component_calls.end()),
+    component_calls.end());
+  build_rows(
+    component_calls, number_of_components(), successor_offsets, successors);
+}
+
+optionalt<call_graph_indext::function_idt>
+call_graph_indext::find(const irep_idt &function) const
+{
+  const auto entry = ids.find(function);
+  if(entry == ids.end())
+    return {};
+
+  return entry->second;
+}
+
+const std::vector<bool> &
+call_graph_indext::get_reachable_components(std::size_t component) const
+{
+  const auto entry = reachable_components.find(component);
+  if(entry != reachable_components.end())
+    return entry->second;
+
+  std::vector<bool> reachable(number_of_components(), false);
+  std::vector<std::size_t> pending{component};
+  reachable[component] = true;
+
+  while(!pending.empty())
+  {
+    const std::size_t current = pending.back();
+    pending.pop_back();
+
+    for(std::size_t i = successor_offsets[current];
+        i < successor_offsets[current + 1];
+        ++i)
+    {
+      if(!reachable[successors[i]])
+      {
+        reachable[successors[i]] = true;
+        pending.push_back(successors[i]);
+      }
+    }
+  }
+
+  return reachable_components.emplace(component, std::move(reachable))
+    .first->second;
+}
+
+bool call_graph_indext::reaches(function_idt from, function_idt to) const
+{
+  const std::size_t from_component = components[from];
+  const std::size_t to_component = components[to];
+
+  if(from_component == to_component)
+    return true;
+
+  // calls never go to a component with a larger number
+  if(to_component > from_component)
+    return false;
+
+  return get_reachable_components(from_component)[to_component];
+}
+
+bool call_graph_indext::reaches(const irep_idt &from, const irep_idt &to) const
+{
+  const auto from_id = find(from);
+  const auto to_id = find(to);
+
+  return from_id.has_value() && to_id.has_value() &&
+         reaches(*from_id, *to_id);
+}
+
+std::vector<irep_idt>
+call_graph_indext::get_reachable_functions(const irep_idt &function) const
+{
+  std::vector<irep_idt> result;
+
+  const auto id = find(function);
+  if(!id.has_value())
+    return result;
+
+  const std::vector<bool> &reachable =
+    get_reachable_components(components[*id]);
+  for(function_idt other = 0; other < size(); ++other)
+  {
+    if(reachable[components[other]])
+      result.push_back(functions[other]);
+  }
+
+  return result;
+}
@@ -0,0 +1,134 @@
+/*******************************************************************\
+
+Module: Function Call Graph Index
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// A compact, read-only call graph that answers reachability queries quickly
+
+#ifndef CPROVER_ANALYSES_CALL_GRAPH_INDEX_H
+#define CPROVER_ANALYSES_CALL_GRAPH_INDEX_H
+
+#include <util/irep.h>
+#include <util/optional.h>
+#include <util/range.h>
+
+#include <unordered_map>
+#include <vector>
+
+class call_grapht;
+
+/// A read-only copy of a \ref call_grapht for answering many queries.
+///
+/// Functions are numbered densely from 0, and the callees and the callers of
+/// all functions are each stored in one array in compressed sparse row form,
+/// i.e. the neighbours of function `i` are the entries from `offsets[i]` to
+/// `offsets[i + 1]`. Parallel edges are only stored once.
+///
+/// The strongly connected components of the graph are numbered in reverse
+/// topological order, such that every call goes to a component with a number
+/// that is not larger than that of the caller. This alone refutes many
+/// reachability queries. The other queries are answered from the set of
+/// components reachable from the component of the caller, which is computed
+/// once for each component that is queried and then kept; this cache is not
+/// thread-safe.
+class call_graph_indext
+{
+public:
+  typedef std::size_t function_idt;
+  typedef std::vector<function_idt>::const_iterator const_iteratort;
+
+  explicit call_graph_indext(const call_grapht &call_graph);
+
+  /// \return the number of functions
+  std::size_t size() const
+  {
+    return functions.size();
+  }
+
+  /// \return the number of \p function, or an empty optional if it is not
+  ///   in the call graph
+  optionalt<function_idt> find(const irep_idt &function) const;
+
+  const irep_idt &get_function(function_idt id) const
+  {
+    return functions[id];
+  }
+
+  /// \return the functions that \p id calls, in increasing order
+  ranget<const_iteratort> callees(function_idt id) const
+  {
+    return make_range(
+      callee_ids.begin() + callee_offsets[id],
+      callee_ids.begin() + callee_offsets[id + 1]);
+  }
+
+  /// \return the functions that call \p id, in increasing order
+  ranget<const_iteratort> callers(function_idt id) const
+  {
+    return make_range(
+      caller_ids.begin() + caller_offsets[id],
+      caller_ids.begin() + caller_offsets[id + 1]);
+  }
+
+  /// \return the number of the strongly connected component of \p id
+  std::size_t get_component(function_idt id) const
+  {
+    return components[id];
+  }
+
+  std::size_t number_of_components() const
+  {
+    return recursive_components.size();
+  }
+
+  /// \return true if \p id can call itself, directly or indirectly
+  bool is_recursive(function_idt id) const
+  {
+    return recursive_components[components[id]];
+  }
+
+  /// \return true if \p to can be called, directly or indirectly, from
+  ///   \p from; each function reaches itself
+  bool reaches(function_idt from, function_idt to) const;
+
+  /// \return true if both functions are in the call graph and \p from
+  ///   reaches \p to
+  bool reaches(const irep_idt &from, const irep_idt &to) const;
+
+  /// \return the functions that \p function reaches, including itself, or
+  ///   nothing if \p function is not in the call graph
+  std::vector<irep_idt> get_reachable_functions(const irep_idt &function) const;
+
+private:
+  std::vector<irep_idt> functions;
+  std::unordered_map<irep_idt, function_idt> ids;
+
+  std::vector<std::size_t> callee_offsets;
+  std::vector<function_idt> callee_ids;
+  std::vector<std::size_t> caller_offsets;
+  std::vector<function_idt> caller_ids;
+
+  /// The component of each function
+  std::vector<std::size_t> components;
+
+  /// Whether each component contains a cycle
+  std::vector<bool> recursive_components;
+
+  /// The components that each component calls, in compressed sparse row form
+  std::vector<std::size_t> successor_offsets;
+  std::vector<std::size_t> successors;
+
+  /// The components reachable from each component queried so far
+  mutable std::unordered_map<std::size_t, std::vector<bool>>
+    reachable_components;
+
+  void compute_components();
+  const std::vector<bool> &get_reachable_components(std::size_t component)
+    const;
+};
+
+#endif // CPROVER_ANALYSES_CALL_GRAPH_INDEX_H
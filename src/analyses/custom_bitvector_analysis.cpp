@@ -19,8 +19,34 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <langapi/language_util.h>
 
+#include <algorithm>
 #include <iostream>
 
+std::size_t custom_bitvector_domaint::find(const irep_idt &identifier) const
+{
+  const auto it = std::lower_bound(objects.begin(), objects.end(), identifier);
+
+  if(it == objects.end() || *it != identifier)
+    return objects.size();
+  else
+    return static_cast<std::size_t>(it - objects.begin());
+}
+
+std::size_t custom_bitvector_domaint::insert(const irep_idt &identifier)
+{
+  const auto it = std::lower_bound(objects.begin(), objects.end(), identifier);
+  const auto row = static_cast<std::size_t>(it - objects.begin());
+
+  if(it == objects.end() || *it != identifier)
+  {
+    objects.insert(it, identifier);
+    may_bits.insert(may_bits.begin() + row, 0);
+    must_bits.insert(must_bits.begin() + row, 0);
+  }
+
+  return row;
+}
+
 void custom_bitvector_domaint::set_bit(
   const irep_idt &identifier,
   unsigned bit_nr,
@@ -29,31 +55,35 @@ void custom_bitvector_domaint::set_bit(
   switch(mode)
   {
   case modet::SET_MUST:
-    set_bit(must_bits[identifier], bit_nr);
+    set_bit(must_bits[insert(identifier)], bit_nr);
     break;
 
   case modet::CLEAR_MUST:
-    clear_bit(must_bits[identifier], bit_nr);
+  {
+    const std::size_t row = find(identifier);
+    if(row != objects.size())
+    {
+      clear_bit(must_bits[row], bit_nr);
+      erase_blank_rows();
+    }
     break;
+  }
 
   case modet::SET_MAY:
-    set_bit(may_bits[identifier], bit_nr);
+    set_bit(may_bits[insert(identifier)], bit_nr);
     break;
 
   case modet::CLEAR_MAY:
-    clear_bit(may_bits[identifier], bit_nr);
+  {
+    const std::size_t row = find(identifier);
+    if(row != objects.size())
+    {
+      clear_bit(may_bits[row], bit_nr);
+      erase_blank_rows();
+    }
     break;
   }
-}
-
-void custom_bitvector_domaint::set_bit(
-  const exprt &lhs,
-  unsigned bit_nr,
-  modet mode)
-{
-  irep_idt id=object2id(lhs);
-  if(!id.empty())
-    set_bit(id, bit_nr, mode);
+  }
 }
 
 irep_idt custom_bitvector_domaint::object2id(const exprt &src)
@@ -123,15 +153,22 @@ void custom_bitvector_domaint::assign_lhs(
 {
   // we erase blank ones to avoid noise
 
-  if(vectors.must_bits==0)
-    must_bits.erase(identifier);
-  else
-    must_bits[identifier]=vectors.must_bits;
-
-  if(vectors.may_bits==0)
-    may_bits.erase(identifier);
+  if(vectors.may_bits == 0 && vectors.must_bits == 0)
+  {
+    const std::size_t row = find(identifier);
+    if(row != objects.size())
+    {
+      objects.erase(objects.begin() + row);
+      may_bits.erase(may_bits.begin() + row);
+      must_bits.erase(must_bits.begin() + row);
+    }
+  }
   else
-    may_bits[identifier]=vectors.may_bits;
+  {
+    const std::size_t row = insert(identifier);
+    may_bits[row] = vectors.may_bits;
+    must_bits[row] = vectors.must_bits;
+  }
 }
 
 custom_bitvector_domaint::vectorst
@@ -139,13 +176,12 @@ custom_bitvector_domaint::vectorst
 {
   vectorst vectors;
 
-  bitst::const_iterator may_it=may_bits.find(identifier);
-  if(may_it!=may_bits.end())
-    vectors.may_bits=may_it->second;
-
-  bitst::const_iterator must_it=must_bits.find(identifier);
-  if(must_it!=must_bits.end())
-    vectors.must_bits=must_it->second;
+  const std::size_t row = find(identifier);
+  if(row != objects.size())
+  {
+    vectors.may_bits = may_bits[row];
+    vectors.must_bits = must_bits[row];
+  }
 
   return vectors;
 }
@@ -189,39 +225,49 @@ unsigned custom_bitvector_analysist::get_bit_nr(
     return bits.number("(unknown)");
 }
 
-std::set<exprt> custom_bitvector_analysist::aliases(
-  const exprt &src,
-  locationt loc)
+const custom_bitvector_analysist::aliasest &
+custom_bitvector_analysist::aliases(const exprt &src, locationt loc)
 {
+  auto entry = alias_cache[loc].emplace(src, aliasest());
+  aliasest &result = entry.first->second;
+
+  if(!entry.second)
+    return result;
+
+  std::set<exprt> alias_set;
+
   if(src.id()==ID_symbol)
   {
-    std::set<exprt> result;
-    result.insert(src);
-    return result;
+    alias_set.insert(src);
   }
   else if(src.id()==ID_dereference)
   {
     exprt pointer=to_dereference_expr(src).pointer();
 
-    const std::set<exprt> alias_set =
-      local_may_alias_factory(loc).get(loc, pointer);
-
-    std::set<exprt> result;
-
-    for(const auto &alias : alias_set)
+    for(const auto &alias : local_may_alias_factory(loc).get(loc, pointer))
       if(alias.type().id() == ID_pointer)
-        result.insert(dereference_exprt(alias));
-
-    result.insert(src);
+        alias_set.insert(dereference_exprt(alias));
 
-    return result;
+    alias_set.insert(src);
   }
   else if(src.id()==ID_typecast)
   {
-    return aliases(to_typecast_expr(src).op(), loc);
+    result = aliases(to_typecast_expr(src).op(), loc);
+    return result;
   }
-  else
-    return std::set<exprt>();
+
+  for(const auto &alias : alias_set)
+  {
+    irep_idt identifier = custom_bitvector_domaint::object2id(alias);
+    if(!identifier.empty())
+      result.push_back(identifier);
+  }
+
+  // different expressions may denote the same object
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+
+  return result;
 }
 
 void custom_bitvector_domaint::assign_struct_rec(
@@ -247,11 +293,9 @@ void custom_bitvector_domaint::assign_struct_rec(
   else
   {
     // may alias other stuff
-    std::set<exprt> lhs_set=cba.aliases(lhs, from);
-
     vectorst rhs_vectors=get_rhs(rhs);
 
-    for(const auto &lhs_alias : lhs_set)
+    for(const auto &lhs_alias : cba.aliases(lhs, from))
     {
       assign_lhs(lhs_alias, rhs_vectors);
     }
@@ -351,19 +395,19 @@ void custom_bitvector_domaint::transform(
               {
                 if(mode==modet::CLEAR_MAY)
                 {
-                  for(auto &bit : may_bits)
-                    clear_bit(bit.second, bit_nr);
+                  for(auto &bits : may_bits)
+                    clear_bit(bits, bit_nr);
 
                   // erase blank ones
-                  erase_blank_vectors(may_bits);
+                  erase_blank_rows();
                 }
                 else if(mode==modet::CLEAR_MUST)
                 {
-                  for(auto &bit : must_bits)
-                    clear_bit(bit.second, bit_nr);
+                  for(auto &bits : must_bits)
+                    clear_bit(bits, bit_nr);
 
                   // erase blank ones
-                  erase_blank_vectors(must_bits);
+                  erase_blank_rows();
                 }
               }
               else
@@ -371,9 +415,7 @@ void custom_bitvector_domaint::transform(
                 dereference_exprt deref(lhs);
 
                 // may alias other stuff
-                std::set<exprt> lhs_set=cba.aliases(deref, from);
-
-                for(const auto &l : lhs_set)
+                for(const auto &l : cba.aliases(deref, from))
                 {
                   set_bit(l, bit_nr, mode);
                 }
@@ -417,11 +459,9 @@ void custom_bitvector_domaint::transform(
               // assignments arguments -> parameters
               symbol_exprt p=ns.lookup(p_identifier).symbol_expr();
               // may alias other stuff
-              std::set<exprt> lhs_set=cba.aliases(p, from);
-
               vectorst rhs_vectors=get_rhs(*arg_it);
 
-              for(const auto &lhs : lhs_set)
+              for(const auto &lhs : cba.aliases(p, from))
               {
                 assign_lhs(lhs, rhs_vectors);
               }
@@ -480,23 +520,19 @@ void custom_bitvector_domaint::transform(
           {
             if(mode==modet::CLEAR_MAY)
             {
-              for(bitst::iterator b_it=may_bits.begin();
-                  b_it!=may_bits.end();
-                  b_it++)
-                clear_bit(b_it->second, bit_nr);
+              for(auto &bits : may_bits)
+                clear_bit(bits, bit_nr);
 
               // erase blank ones
-              erase_blank_vectors(may_bits);
+              erase_blank_rows();
             }
             else if(mode==modet::CLEAR_MUST)
             {
-              for(bitst::iterator b_it=must_bits.begin();
-                  b_it!=must_bits.end();
-                  b_it++)
-                clear_bit(b_it->second, bit_nr);
+              for(auto &bits : must_bits)
+                clear_bit(bits, bit_nr);
 
               // erase blank ones
-              erase_blank_vectors(must_bits);
+              erase_blank_rows();
             }
           }
           else
@@ -504,9 +540,7 @@ void custom_bitvector_domaint::transform(
             dereference_exprt deref(lhs);
 
             // may alias other stuff
-            std::set<exprt> lhs_set=cba.aliases(deref, from);
-
-            for(const auto &l : lhs_set)
+            for(const auto &l : cba.aliases(deref, from))
             {
               set_bit(l, bit_nr, mode);
             }
@@ -571,10 +605,13 @@ void custom_bitvector_domaint::output(
   const custom_bitvector_analysist &cba=
     static_cast<const custom_bitvector_analysist &>(ai);
 
-  for(const auto &bit : may_bits)
+  for(std::size_t row = 0; row < objects.size(); ++row)
   {
-    out << bit.first << " MAY:";
-    bit_vectort b=bit.second;
+    bit_vectort b = may_bits[row];
+    if(b == 0)
+      continue;
+
+    out << objects[row] << " MAY:";
 
     for(unsigned i=0; b!=0; i++, b>>=1)
       if(b&1)
@@ -587,10 +624,13 @@ void custom_bitvector_domaint::output(
     out << '\n';
   }
 
-  for(const auto &bit : must_bits)
+  for(std::size_t row = 0; row < objects.size(); ++row)
   {
-    out << bit.first << " MUST:";
-    bit_vectort b=bit.second;
+    bit_vectort b = must_bits[row];
+    if(b == 0)
+      continue;
+
+    out << objects[row] << " MUST:";
 
     for(unsigned i=0; b!=0; i++, b>>=1)
       if(b&1)
@@ -609,77 +649,124 @@ bool custom_bitvector_domaint::merge(
   trace_ptrt,
   trace_ptrt)
 {
-  bool changed=has_values.is_false();
+  if(b.is_bottom())
+    return false;
+
+  if(is_bottom())
+  {
+    objects = b.objects;
+    may_bits = b.may_bits;
+    must_bits = b.must_bits;
+    has_values = tvt::unknown();
+    return true;
+  }
+
   has_values=tvt::unknown();
 
-  // first do MAY
-  bitst::iterator it=may_bits.begin();
-  for(const auto &bit : b.may_bits)
+  bool changed=false;
+
+  if(objects == b.objects)
   {
-    while(it!=may_bits.end() && it->first<bit.first)
-      ++it;
-    if(it==may_bits.end() || bit.first<it->first)
+    // the common case: the same objects have bits set on both sides, and
+    // the join is done word by word
+    for(std::size_t row = 0; row < objects.size(); ++row)
     {
-      may_bits.insert(it, bit);
-      changed=true;
+      const bit_vectort may = may_bits[row] | b.may_bits[row];
+      const bit_vectort must = must_bits[row] & b.must_bits[row];
+      changed |= may != may_bits[row] || must != must_bits[row];
+      may_bits[row] = may;
+      must_bits[row] = must;
     }
-    else if(it!=may_bits.end())
-    {
-      bit_vectort &a_bits=it->second;
-      bit_vectort old=a_bits;
-      a_bits|=bit.second;
-      if(old!=a_bits)
-        changed=true;
 
-      ++it;
-    }
+    // erase blank ones
+    if(changed)
+      erase_blank_rows();
+
+    return changed;
   }
 
-  // now do MUST
-  it=must_bits.begin();
-  for(auto &bit : b.must_bits)
+  std::vector<irep_idt> new_objects;
+  std::vector<bit_vectort> new_may_bits, new_must_bits;
+  new_objects.reserve(objects.size() + b.objects.size());
+  new_may_bits.reserve(objects.size() + b.objects.size());
+  new_must_bits.reserve(objects.size() + b.objects.size());
+
+  std::size_t a_row = 0, b_row = 0;
+  while(a_row < objects.size() || b_row < b.objects.size())
   {
-    while(it!=must_bits.end() && it->first<bit.first)
+    irep_idt object;
+    bit_vectort may, must;
+
+    if(
+      b_row == b.objects.size() ||
+      (a_row < objects.size() && objects[a_row] < b.objects[b_row]))
     {
-      it=must_bits.erase(it);
-      changed=true;
+      // MUST bits are not set on the other side
+      object = objects[a_row];
+      may = may_bits[a_row];
+      must = 0;
+      changed |= must_bits[a_row] != 0;
+      ++a_row;
     }
-    if(it==must_bits.end() || bit.first<it->first)
+    else if(a_row == objects.size() || b.objects[b_row] < objects[a_row])
     {
-      must_bits.insert(it, bit);
-      changed=true;
+      // likewise, MUST bits are not set on this side, so only the MAY bits
+      // of the other side are kept
+      object = b.objects[b_row];
+      may = b.may_bits[b_row];
+      must = 0;
+      changed |= may != 0;
+      ++b_row;
     }
-    else if(it!=must_bits.end())
+    else
     {
-      bit_vectort &a_bits=it->second;
-      bit_vectort old=a_bits;
-      a_bits&=bit.second;
-      if(old!=a_bits)
-        changed=true;
+      object = objects[a_row];
+      may = may_bits[a_row] | b.may_bits[b_row];
+      must = must_bits[a_row] & b.must_bits[b_row];
+      changed |= may != may_bits[a_row] || must != must_bits[a_row];
+      ++a_row;
+      ++b_row;
+    }
 
-      ++it;
+    // erase blank ones
+    if(may != 0 || must != 0)
+    {
+      new_objects.push_back(object);
+      new_may_bits.push_back(may);
+      new_must_bits.push_back(must);
     }
   }
 
-  // erase blank ones
-  erase_blank_vectors(may_bits);
-  erase_blank_vectors(must_bits);
+  objects.swap(new_objects);
+  may_bits.swap(new_may_bits);
+  must_bits.swap(new_must_bits);
 
   return changed;
 }
 
-/// erase blank bitvectors
-void custom_bitvector_domaint::erase_blank_vectors(bitst &bits)
+/// erase the rows that have no bits set
+void custom_bitvector_domaint::erase_blank_rows()
 {
-  for(bitst::iterator a_it=bits.begin();
-      a_it!=bits.end();
-     ) // no a_it++
+  std::size_t to = 0;
+
+  for(std::size_t from = 0; from < objects.size(); ++from)
   {
-    if(a_it->second==0)
-      a_it=bits.erase(a_it);
-    else
-      a_it++;
+    if(may_bits[from] == 0 && must_bits[from] == 0)
+      continue;
+
+    if(to != from)
+    {
+      objects[to] = objects[from];
+      may_bits[to] = may_bits[from];
+      must_bits[to] = must_bits[from];
+    }
+
+    ++to;
   }
+
+  objects.resize(to);
+  may_bits.resize(to);
+  must_bits.resize(to);
 }
 
 bool custom_bitvector_domaint::has_get_must_or_may(const exprt &src)
@@ -716,8 +803,8 @@ exprt custom_bitvector_domaint::eval(
       {
         if(src.id() == ID_get_may)
         {
-          for(const auto &bit : may_bits)
-            if(get_bit(bit.second, bit_nr))
+          for(const auto &bits : may_bits)
+            if(get_bit(bits, bit_nr))
               return true_exprt();
 
           return false_exprt();
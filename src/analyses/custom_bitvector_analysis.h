@@ -12,9 +12,13 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_ANALYSES_CUSTOM_BITVECTOR_ANALYSIS_H
 #define CPROVER_ANALYSES_CUSTOM_BITVECTOR_ANALYSIS_H
 
+#include <util/irep_hash.h>
 #include <util/numbering.h>
 #include <util/threeval.h>
 
+#include <unordered_map>
+#include <vector>
+
 #include "ai.h"
 #include "local_may_alias.h"
 
@@ -38,15 +42,13 @@ class custom_bitvector_domaint:public ai_domain_baset
 
   void make_bottom() final override
   {
-    may_bits.clear();
-    must_bits.clear();
+    clear();
     has_values=tvt(false);
   }
 
   void make_top() final override
   {
-    may_bits.clear();
-    must_bits.clear();
+    clear();
     has_values=tvt(true);
   }
 
@@ -57,16 +59,14 @@ class custom_bitvector_domaint:public ai_domain_baset
 
   bool is_bottom() const final override
   {
-    DATA_INVARIANT(!has_values.is_false() ||
-                   (may_bits.empty() && must_bits.empty()),
+    DATA_INVARIANT(!has_values.is_false() || objects.empty(),
                    "If the domain is bottom, it must have no bits set");
     return has_values.is_false();
   }
 
   bool is_top() const final override
   {
-    DATA_INVARIANT(!has_values.is_true() ||
-                   (may_bits.empty() && must_bits.empty()),
+    DATA_INVARIANT(!has_values.is_true() || objects.empty(),
                    "If the domain is top, it must have no bits set");
     return has_values.is_true();
   }
@@ -75,8 +75,6 @@ class custom_bitvector_domaint:public ai_domain_baset
 
   typedef unsigned long long bit_vectort;
 
-  typedef std::map<irep_idt, bit_vectort> bitst;
-
   struct vectorst
   {
     bit_vectort may_bits, must_bits;
@@ -93,7 +91,12 @@ class custom_bitvector_domaint:public ai_domain_baset
     return result;
   }
 
-  bitst may_bits, must_bits;
+  /// The objects that have any bits set, in ascending order. The bits of
+  /// `objects[i]` are `may_bits[i]` and `must_bits[i]`; keeping the rows in
+  /// flat arrays makes the transfer functions operations on single rows and
+  /// the join a word-wise operation on the arrays.
+  std::vector<irep_idt> objects;
+  std::vector<bit_vectort> may_bits, must_bits;
 
   void assign_struct_rec(
     locationt from,
@@ -118,10 +121,11 @@ class custom_bitvector_domaint:public ai_domain_baset
     const exprt &src,
     custom_bitvector_analysist &) const;
 
+  static irep_idt object2id(const exprt &);
+
 private:
   enum class modet { SET_MUST, CLEAR_MUST, SET_MAY, CLEAR_MAY };
 
-  void set_bit(const exprt &, unsigned bit_nr, modet);
   void set_bit(const irep_idt &, unsigned bit_nr, modet);
 
   static inline void set_bit(bit_vectort &dest, unsigned bit_nr)
@@ -140,9 +144,20 @@ class custom_bitvector_domaint:public ai_domain_baset
     return (src&(1ll<<bit_nr))!=0;
   }
 
-  void erase_blank_vectors(bitst &);
+  void clear()
+  {
+    objects.clear();
+    may_bits.clear();
+    must_bits.clear();
+  }
 
-  static irep_idt object2id(const exprt &);
+  /// \return the row of \p identifier, or `objects.size()` if it has no bits
+  std::size_t find(const irep_idt &identifier) const;
+
+  /// \return the row of \p identifier, which is added if it has no bits
+  std::size_t insert(const irep_idt &identifier);
+
+  void erase_blank_rows();
 };
 
 class custom_bitvector_analysist:public ait<custom_bitvector_domaint>
@@ -174,7 +189,18 @@ class custom_bitvector_analysist:public ait<custom_bitvector_domaint>
 
   local_may_alias_factoryt local_may_alias_factory;
 
-  std::set<exprt> aliases(const exprt &, locationt loc);
+  typedef std::vector<irep_idt> aliasest;
+
+  /// \return the identifiers of the objects that \p src may alias at
+  ///   \p loc, which are cached as the alias information does not change
+  ///   while the fixed point is computed
+  const aliasest &aliases(const exprt &src, locationt loc);
+
+  std::unordered_map<
+    locationt,
+    std::unordered_map<exprt, aliasest, irep_hash>,
+    const_target_hash>
+    alias_cache;
 };
 
 #endif // CPROVER_ANALYSES_CUSTOM_BITVECTOR_ANALYSIS_H
@@ -357,44 +357,30 @@ void rd_range_domaint::kill(
   if(entry==values.end())
     return;
 
-  bool clear_export_cache=false;
+  values_innert killed;
   values_innert new_values;
 
-  for(values_innert::iterator
-      it=entry->second.begin();
-      it!=entry->second.end();
-     ) // no ++it
+  for(const auto &id : entry->second)
   {
-    const reaching_definitiont &v=bv_container->get(*it);
+    const reaching_definitiont &v=bv_container->get(id);
 
     if(v.bit_begin >= range_end)
-      ++it;
+      continue;
     else if(!v.bit_end.is_unknown() && v.bit_end <= range_start)
-    {
-      ++it;
-    }
+      continue;
     else if(
       v.bit_begin >= range_start && !v.bit_end.is_unknown() &&
       v.bit_end <= range_end) // rs <= a < b <= re
     {
-      clear_export_cache=true;
-
-      entry->second.erase(it++);
     }
     else if(v.bit_begin >= range_start) // rs <= a <= re < b
     {
-      clear_export_cache=true;
-
       reaching_definitiont v_new=v;
       v_new.bit_begin=range_end;
       new_values.insert(bv_container->add(v_new));
-
-      entry->second.erase(it++);
     }
     else if(v.bit_end.is_unknown() || v.bit_end > range_end) // a <= rs < re < b
     {
-      clear_export_cache=true;
-
       reaching_definitiont v_new=v;
       v_new.bit_end=range_start;
 
@@ -403,39 +389,24 @@ void rd_range_domaint::kill(
 
       new_values.insert(bv_container->add(v_new));
       new_values.insert(bv_container->add(v_new2));
-
-      entry->second.erase(it++);
     }
     else // a <= rs < b <= re
     {
-      clear_export_cache=true;
-
       reaching_definitiont v_new=v;
       v_new.bit_end=range_start;
       new_values.insert(bv_container->add(v_new));
-
-      entry->second.erase(it++);
     }
+
+    killed.insert(id);
   }
 
-  if(clear_export_cache)
-    export_cache.erase(identifier);
+  if(killed.empty())
+    return;
 
-  values_innert::iterator it=entry->second.begin();
-  for(const auto &id : new_values)
-  {
-    while(it!=entry->second.end() && *it<id)
-      ++it;
-    if(it==entry->second.end() || id<*it)
-    {
-      entry->second.insert(it, id);
-    }
-    else if(it!=entry->second.end())
-    {
-      assert(*it==id);
-      ++it;
-    }
-  }
+  export_cache.erase(identifier);
+
+  entry->second.erase(killed);
+  entry->second.insert(new_values);
 }
 
 void rd_range_domaint::kill_inf(
@@ -490,7 +461,7 @@ bool rd_range_domaint::gen(
   PRECONDITION(range_end == range_spect::unknown() || range_end > range_start);
 
   reaching_definitiont v{identifier, from, range_start, range_end};
-  if(!values[identifier].insert(bv_container->add(v)).second)
+  if(!values[identifier].insert(bv_container->add(v)))
     return false;
 
   export_cache.erase(identifier);
@@ -610,22 +581,7 @@ bool rd_range_domaint::merge_inner(
     }
   }
 #else
-  values_innert::iterator itr=dest.begin();
-  for(const auto &id : other)
-  {
-    while(itr!=dest.end() && *itr<id)
-      ++itr;
-    if(itr==dest.end() || id<*itr)
-    {
-      dest.insert(itr, id);
-      more=true;
-    }
-    else if(itr!=dest.end())
-    {
-      assert(*itr==id);
-      ++itr;
-    }
-  }
+  more=dest.insert(other);
 #endif
 
   return more;
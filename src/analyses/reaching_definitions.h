@@ -25,6 +25,7 @@ Date: February 2013
 #ifndef CPROVER_ANALYSES_REACHING_DEFINITIONS_H
 #define CPROVER_ANALYSES_REACHING_DEFINITIONS_H
 
+#include <util/packed_bitset.h>
 #include <util/threeval.h>
 
 #include "ai.h"
@@ -272,7 +273,11 @@ class rd_range_domaint:public ai_domain_baset
   /// `this` is passed to `set_bitvector_container` for all instances.
   sparse_bitvector_analysist<reaching_definitiont> *const bv_container;
 
-  typedef std::set<std::size_t> values_innert;
+  /// The `ID`s of the reaching definitions of a single variable. As `ID`s
+  /// are handed out as definitions are discovered, those of one variable are
+  /// mostly close to each other and the packed representation makes joins
+  /// and kills a matter of a few word operations.
+  typedef packed_bitsett values_innert;
   #ifdef USE_DSTRING
   typedef std::map<irep_idt, values_innert> valuest;
   #else
@@ -0,0 +1,161 @@
+/*******************************************************************\
+
+Module: Abstract Interpretation
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Storage that only keeps domains where they cannot be cheaply recomputed
+
+#include "sparse_history_storage.h"
+
+#include <goto-programs/goto_functions.h>
+
+#include "ai.h"
+
+sparse_history_storaget::sparse_history_storaget(
+  const goto_functionst &goto_functions,
+  const namespacet &ns)
+  : ns(ns)
+{
+  for(const auto &gf_entry : goto_functions.function_map)
+  {
+    const goto_programt &body = gf_entry.second.body;
+    if(body.instructions.empty())
+      continue;
+
+    std::unordered_map<const goto_programt::instructiont *, std::size_t>
+      number_of_predecessors;
+    std::unordered_map<const goto_programt::instructiont *, locationt>
+      predecessor;
+
+    for(auto it = body.instructions.begin(); it != body.instructions.end();
+        ++it)
+    {
+      for(const auto &successor : body.get_successors(it))
+      {
+        if(successor == body.instructions.end())
+          continue;
+
+        ++number_of_predecessors[&*successor];
+        predecessor[&*successor] = it;
+      }
+    }
+
+    for(auto it = std::next(body.instructions.begin());
+        it != body.instructions.end();
+        ++it)
+    {
+      if(
+        it->is_function_call() || it->is_end_function() ||
+        number_of_predecessors[&*it] != 1)
+      {
+        continue;
+      }
+
+      const locationt &p = predecessor.at(&*it);
+      if(p == it || p->is_function_call())
+        continue;
+
+      predecessors.emplace(&*it, predecessort{p, gf_entry.first});
+    }
+  }
+}
+
+ai_storage_baset::cstate_ptrt sparse_history_storaget::abstract_state_before(
+  trace_ptrt p,
+  const ai_domain_factory_baset &fac) const
+{
+  auto it = domain_map.find(p);
+  if(it != domain_map.end())
+    return it->second;
+
+  return cstate_ptrt(recompute(p, fac).release());
+}
+
+ai_storage_baset::cstate_ptrt sparse_history_storaget::abstract_state_before(
+  locationt l,
+  const ai_domain_factory_baset &fac) const
+{
+  auto traces = abstract_traces_before(l);
+
+  if(traces->size() == 1)
+    return abstract_state_before(*(traces->begin()), fac);
+
+  auto res = fac.make(l);
+  for(const auto &p : *traces)
+    fac.merge(*res, *abstract_state_before(p, fac), p, p);
+
+  return cstate_ptrt(res.release());
+}
+
+void sparse_history_storaget::prune(locationt l)
+{
+  if(is_kept(l))
+    return;
+
+  for(const auto &p : *abstract_traces_before(l))
+    domain_map.erase(p);
+}
+
+void sparse_history_storaget::prune(trace_ptrt p)
+{
+  if(!is_kept(p->current_location()))
+    domain_map.erase(p);
+}
+
+std::unique_ptr<ai_storage_baset::statet> sparse_history_storaget::recompute(
+  trace_ptrt p,
+  const ai_domain_factory_baset &fac) const
+{
+  // Walk back to the nearest history whose domain is stored. As domains are
+  // kept at all joins, each history on the way has a unique predecessor.
+  std::vector<trace_ptrt> chain;
+  trace_ptrt t = p;
+  auto stored = domain_map.find(t);
+
+  while(stored == domain_map.end())
+  {
+    const locationt &l = t->current_location();
+    const auto predecessor = predecessors.find(&*l);
+    if(predecessor == predecessors.end() || analyzer == nullptr)
+      return fac.make(p->current_location());
+
+    chain.push_back(t);
+
+    trace_ptrt previous = nullptr;
+    for(const auto &q : *abstract_traces_before(predecessor->second.location))
+    {
+      auto next = q->step(
+        l, *abstract_traces_before(l), ai_history_baset::no_caller_history);
+      if(
+        next.first != ai_history_baset::step_statust::BLOCKED &&
+        *next.second == *t)
+      {
+        previous = q;
+        break;
+      }
+    }
+
+    // Not reached
+    if(previous == nullptr)
+      return fac.make(p->current_location());
+
+    t = previous;
+    stored = domain_map.find(t);
+  }
+
+  std::unique_ptr<statet> state = fac.copy(*stored->second);
+
+  for(auto it = chain.rbegin(); it != chain.rend(); ++it)
+  {
+    const irep_idt &function_id =
+      predecessors.at(&*(*it)->current_location()).function_id;
+    state->transform(function_id, t, function_id, *it, *analyzer, ns);
+    t = *it;
+  }
+
+  return state;
+}
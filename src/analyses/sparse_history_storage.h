@@ -0,0 +1,89 @@
+/*******************************************************************\
+
+Module: Abstract Interpretation
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Storage that only keeps domains where they cannot be cheaply recomputed
+
+#ifndef CPROVER_ANALYSES_SPARSE_HISTORY_STORAGE_H
+#define CPROVER_ANALYSES_SPARSE_HISTORY_STORAGE_H
+
+#include "ai_storage.h"
+
+#include <unordered_map>
+
+class ai_baset;
+class goto_functionst;
+class namespacet;
+
+/// Like history_sensitive_storaget, but domains are only kept for the
+/// histories of locations where control flow joins (which includes all loop
+/// heads), the first and last instruction of each function, function calls
+/// and the instructions following them. Every other location has a unique
+/// predecessor and its domain is the result of a single transformer, so the
+/// abstract interpreter prunes it once it has been used and the storage
+/// recomputes it on demand by replaying the transformers from the nearest
+/// kept predecessor.
+///
+/// Recomputation needs the abstract interpreter that the storage belongs to;
+/// see \ref set_analyzer.
+class sparse_history_storaget : public history_sensitive_storaget
+{
+public:
+  /// \param goto_functions: the functions that will be analysed, which must
+  ///   outlive the storage
+  /// \param ns: namespace to use when replaying transformers, which must
+  ///   outlive the storage
+  sparse_history_storaget(
+    const goto_functionst &goto_functions,
+    const namespacet &ns);
+
+  /// Set the abstract interpreter that is passed to the transformers when
+  /// recomputing domains. Until this has been called, domains that have been
+  /// pruned are bottom.
+  void set_analyzer(ai_baset &ai)
+  {
+    analyzer = &ai;
+  }
+
+  cstate_ptrt abstract_state_before(
+    trace_ptrt p,
+    const ai_domain_factory_baset &fac) const override;
+
+  cstate_ptrt abstract_state_before(
+    locationt l,
+    const ai_domain_factory_baset &fac) const override;
+
+  void prune(locationt l) override;
+  void prune(trace_ptrt p) override;
+
+  /// \return true if domains are kept for the histories of \p l
+  bool is_kept(locationt l) const
+  {
+    return predecessors.find(&*l) == predecessors.end();
+  }
+
+protected:
+  struct predecessort
+  {
+    locationt location;
+    irep_idt function_id;
+  };
+
+  /// The unique predecessor of each location whose domains are not kept
+  std::unordered_map<const goto_programt::instructiont *, predecessort>
+    predecessors;
+
+  const namespacet &ns;
+  ai_baset *analyzer = nullptr;
+
+  /// \return the state of \p p, recomputing it if it has been pruned
+  std::unique_ptr<statet>
+  recompute(trace_ptrt p, const ai_domain_factory_baset &fac) const;
+};
+
+#endif // CPROVER_ANALYSES_SPARSE_HISTORY_STORAGE_H
@@ -99,6 +99,19 @@ abstract_environmentt::eval(const exprt &expr, const namespacet &ns) const
   // first try to canonicalise, including constant folding
   const exprt &simplified_expr = simplify_expr(expr, ns);
 
+  // comparisons may be decided by the relations between variables
+  if(!zones.empty() && simplified_expr.type().id() == ID_bool)
+  {
+    const zone_packingt *packing = zone_packing();
+    const tvt result =
+      packing ? zones.evaluate(simplified_expr, *this, *packing, ns)
+              : tvt::unknown();
+    if(result.is_true())
+      return abstract_object_factory(simplified_expr.type(), true_exprt(), ns);
+    if(result.is_false())
+      return abstract_object_factory(simplified_expr.type(), false_exprt(), ns);
+  }
+
   const irep_idt simplified_id = simplified_expr.id();
   if(simplified_id == ID_symbol)
     return resolve_symbol(simplified_expr, ns);
@@ -225,6 +238,15 @@ bool abstract_environmentt::assign(
   {
     symbol_exprt symbol_expr = to_symbol_expr(s);
 
+    if(!zones.empty())
+    {
+      if(const zone_packingt *packing = zone_packing())
+        zones.forget(symbol_expr.get_identifier(), *packing);
+    }
+
+    if(object_factory)
+      final_value = object_factory->intern(final_value);
+
     if(final_value != lhs_value)
     {
       CHECK_RETURN(!symbol_expr.get_identifier().empty());
@@ -234,6 +256,28 @@ bool abstract_environmentt::assign(
   return true;
 }
 
+bool abstract_environmentt::assign(
+  const exprt &expr,
+  const exprt &rhs,
+  const abstract_object_pointert &value,
+  const namespacet &ns)
+{
+  zone_packingt *packing = zone_packing();
+  if(!packing || bottom || expr.id() != ID_symbol)
+    return assign(expr, value, ns);
+
+  // the relations after the assignment follow from the environment before it
+  packed_zonest relations = zones;
+  relations.assign(
+    to_symbol_expr(expr), simplify_expr(rhs, ns), *this, *packing, ns);
+
+  const bool result = assign(expr, value, ns);
+  if(!bottom)
+    zones = std::move(relations);
+
+  return result;
+}
+
 abstract_object_pointert abstract_environmentt::write(
   const abstract_object_pointert &lhs,
   const abstract_object_pointert &rhs,
@@ -262,7 +306,20 @@ bool abstract_environmentt::assume(const exprt &expr, const namespacet &ns)
   PRECONDITION(expr.type().id() == ID_bool);
 
   auto simplified = simplify_expr(expr, ns);
+
+  zone_packingt *packing = zone_packing();
+  if(packing && !bottom && !zones.assume(simplified, *this, *packing, ns))
+  {
+    make_bottom();
+    return true;
+  }
+
+  // the values are only narrowed by assuming, which keeps the relations
+  // between them
+  const packed_zonest relations = zones;
   auto assumption = do_assume(simplified, ns);
+  if(!bottom)
+    zones = relations;
 
   if(assumption.id() != ID_nil) // I.E. actually a value
   {
@@ -345,6 +402,22 @@ const vsd_configt &abstract_environmentt::configuration() const
   return object_factory->config();
 }
 
+zone_packingt *abstract_environmentt::zone_packing() const
+{
+  return object_factory ? object_factory->zone_packing() : nullptr;
+}
+
+/// \return true if a backwards goto leads to \p location
+static bool is_loop_head(const goto_programt::const_targett &location)
+{
+  return std::any_of(
+    location->incoming_edges.begin(),
+    location->incoming_edges.end(),
+    [](const goto_programt::targett &source) {
+      return source->is_backwards_goto();
+    });
+}
+
 bool abstract_environmentt::merge(
   const abstract_environmentt &env,
   const goto_programt::const_targett &merge_location,
@@ -366,13 +439,39 @@ bool abstract_environmentt::merge(
   bool modified = false;
   for(const auto &entry : env.map.get_delta_view(map))
   {
+    const abstract_object_pointert &current = entry.get_other_map_value();
+
+    // Values that were interned are equal if and only if they are the same
+    // object, which saves merging them
+    if(current == entry.m)
+    {
+      if(object_factory)
+        object_factory->record_merge(true, false);
+      continue;
+    }
+
     auto merge_result = abstract_objectt::merge(
-      entry.get_other_map_value(), entry.m, merge_location, widen_mode);
+      current, entry.m, merge_location, widen_mode);
+
+    if(merge_result.modified && object_factory)
+      merge_result.object = object_factory->intern(merge_result.object);
+    if(object_factory)
+      object_factory->record_merge(false, merge_result.modified);
 
-    modified |= merge_result.modified;
+    modified |= merge_result.object != current;
     map.replace(entry.k, merge_result.object);
   }
 
+  // widen the relations at loop heads, where ascending chains would
+  // otherwise only be cut short by the bound on the number of joins
+  zone_packingt *packing = zone_packing();
+  if(packing && !zones.empty())
+  {
+    const bool widen =
+      widen_mode == widen_modet::could_widen || is_loop_head(merge_location);
+    modified |= zones.merge(env.zones, *packing, widen);
+  }
+
   return modified;
 }
 
@@ -386,12 +485,14 @@ void abstract_environmentt::make_top()
 {
   // since we assume anything is not in the map is top this is sufficient
   map.clear();
+  zones.clear();
   bottom = false;
 }
 
 void abstract_environmentt::make_bottom()
 {
   map.clear();
+  zones.clear();
   bottom = true;
 }
 
@@ -402,7 +503,7 @@ bool abstract_environmentt::is_bottom() const
 
 bool abstract_environmentt::is_top() const
 {
-  return map.empty() && !bottom;
+  return map.empty() && zones.empty() && !bottom;
 }
 
 void abstract_environmentt::output(
@@ -419,6 +520,8 @@ void abstract_environmentt::output(
     out << "\n";
   }
 
+  zones.output(out);
+
   out << "}\n";
 }
 
@@ -476,6 +579,12 @@ abstract_object_pointert abstract_environmentt::eval_expression(
 void abstract_environmentt::erase(const symbol_exprt &expr)
 {
   map.erase_if_exists(expr.get_identifier());
+
+  if(!zones.empty())
+  {
+    if(const zone_packingt *packing = zone_packing())
+      zones.forget(expr.get_identifier(), *packing);
+  }
 }
 
 std::vector<abstract_environmentt::map_keyt>
@@ -528,6 +637,8 @@ abstract_environmentt::gather_statistics(const namespacet &ns) const
 {
   abstract_object_statisticst statistics = {};
   statistics.number_of_globals = count_globals(ns);
+  if(object_factory)
+    object_factory->get_statistics(statistics);
   abstract_object_visitedt visited;
   for(auto const &object : map.get_view())
   {
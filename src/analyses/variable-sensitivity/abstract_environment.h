@@ -20,6 +20,7 @@
 #include <memory>
 
 #include <analyses/variable-sensitivity/abstract_object.h>
+#include <analyses/variable-sensitivity/packed_zones.h>
 
 exprt simplify_vsd_expr(exprt src, const namespacet &ns);
 bool is_ptr_diff(const exprt &expr);
@@ -93,6 +94,22 @@ class abstract_environmentt
     const abstract_object_pointert &value,
     const namespacet &ns);
 
+  /// Assign \p value, which is the value of \p rhs, to \p expr, and update
+  /// the relations between variables if they are tracked (see
+  /// \ref vsd_configt::relations)
+  ///
+  /// \param expr: the expression to assign to
+  /// \param rhs: the expression that is assigned
+  /// \param value: the value of \p rhs in this environment
+  /// \param ns: the namespace
+  ///
+  /// \return A boolean, true if the assignment has changed the domain.
+  bool assign(
+    const exprt &expr,
+    const exprt &rhs,
+    const abstract_object_pointert &value,
+    const namespacet &ns);
+
   /// Reduces the domain based on a condition
   ///
   /// \param expr: the expression that is to be assumed
@@ -261,6 +278,10 @@ class abstract_environmentt
 
   sharing_mapt<map_keyt, abstract_object_pointert> map;
 
+  /// The relations between integer variables, which are only tracked if the
+  /// configuration asks for them
+  packed_zonest zones;
+
 private:
   /// Look at the configuration for the sensitivity and create an
   /// appropriate abstract_object
@@ -284,6 +305,10 @@ class abstract_environmentt
     const abstract_environmentt &environment,
     const namespacet &ns) const;
 
+  /// \return the packs of related variables, or a null pointer if relations
+  ///   are not tracked
+  zone_packingt *zone_packing() const;
+
   variable_sensitivity_object_factory_ptrt object_factory;
 };
 
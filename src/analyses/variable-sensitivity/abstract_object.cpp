@@ -224,6 +224,10 @@ abstract_objectt::combine_result abstract_objectt::merge(
   const abstract_object_pointert &op2,
   const widen_modet &widen_mode)
 {
+  // Merging an object with itself does not change it
+  if(op1 == op2)
+    return {op1, false};
+
   abstract_object_pointert result = op1->should_use_base_merge(op2)
                                       ? op1->abstract_object_merge(op2)
                                       : op1->merge(op2, widen_mode);
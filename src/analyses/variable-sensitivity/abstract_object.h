@@ -375,6 +375,14 @@ class abstract_objectt : public std::enable_shared_from_this<abstract_objectt>
     return shared_from_this() == other;
   }
 
+  /// \return true if \ref internal_hash and \ref internal_equality compare
+  ///   the values of objects rather than their addresses, such that equal
+  ///   objects can share a single instance
+  virtual bool has_value_equality() const
+  {
+    return false;
+  }
+
   /// to_predicate implementation - derived classes will override
   /// \param name - the variable name to substitute into the expression
   /// \return Returns an exprt representing the object as an invariant.
@@ -24,6 +24,15 @@ struct abstract_object_statisticst
   std::size_t number_of_pointers = 0;
   std::size_t number_of_constants = 0;
   std::size_t number_of_globals = 0;
+  /// Number of merges of the values of variables
+  std::size_t number_of_merges = 0;
+  /// Number of merges that were skipped as both values were the same object
+  std::size_t number_of_merge_shortcuts = 0;
+  /// Number of merges that allocated a new object
+  std::size_t number_of_merge_allocations = 0;
+  /// Number of times an equal object was found in the table of unique objects
+  /// and used instead of a new one
+  std::size_t number_of_shared_objects = 0;
   /// An underestimation of the memory usage of the abstract objects
   memory_sizet objects_memory_usage;
 };
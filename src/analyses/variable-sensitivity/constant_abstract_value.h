@@ -63,6 +63,11 @@ class constant_abstract_valuet : public abstract_value_objectt
     return cast_other && value == cast_other->value;
   }
 
+  bool has_value_equality() const override
+  {
+    return true;
+  }
+
 protected:
   CLONE
 
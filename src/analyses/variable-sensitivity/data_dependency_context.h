@@ -62,6 +62,13 @@ class data_dependency_contextt : public write_location_contextt
   void output(std::ostream &out, const class ai_baset &ai, const namespacet &ns)
     const override;
 
+  /// The data dependencies and dominators are not compared by
+  /// \ref write_location_contextt::internal_equality
+  bool has_value_equality() const override
+  {
+    return false;
+  }
+
 protected:
   CLONE
 
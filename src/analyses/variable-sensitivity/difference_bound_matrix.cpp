@@ -0,0 +1,349 @@
+/*******************************************************************\
+
+ Module: analyses variable-sensitivity
+
+ Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// A difference bound matrix, which represents a conjunction of constraints
+/// of the form `x - y <= c` over integer variables.
+
+#include "difference_bound_matrix.h"
+
+#include <algorithm>
+#include <ostream>
+
+constexpr difference_bound_matrixt::boundt difference_bound_matrixt::infinity;
+constexpr difference_bound_matrixt::boundt difference_bound_matrixt::minimum;
+
+optionalt<std::size_t>
+difference_bound_matrixt::index_of(const irep_idt &identifier) const
+{
+  for(std::size_t i = 0; i < variables.size(); ++i)
+  {
+    if(variables[i] == identifier)
+      return i + 1;
+  }
+
+  return {};
+}
+
+std::size_t difference_bound_matrixt::add_variable(const irep_idt &identifier)
+{
+  PRECONDITION(!index_of(identifier).has_value());
+
+  const std::size_t old_dimension = dimension();
+  const std::size_t new_dimension = old_dimension + 1;
+
+  std::vector<boundt> new_bounds(new_dimension * new_dimension, infinity);
+  for(std::size_t i = 0; i < old_dimension; ++i)
+  {
+    std::copy(
+      bounds.begin() + i * old_dimension,
+      bounds.begin() + (i + 1) * old_dimension,
+      new_bounds.begin() + i * new_dimension);
+  }
+  new_bounds.back() = 0;
+
+  variables.push_back(identifier);
+  bounds.swap(new_bounds);
+
+  return old_dimension;
+}
+
+void difference_bound_matrixt::remove_variable(std::size_t index)
+{
+  PRECONDITION(index >= 1 && index < dimension());
+
+  const std::size_t old_dimension = dimension();
+  const std::size_t new_dimension = old_dimension - 1;
+
+  std::vector<boundt> new_bounds;
+  new_bounds.reserve(new_dimension * new_dimension);
+  for(std::size_t i = 0; i < old_dimension; ++i)
+  {
+    if(i == index)
+      continue;
+
+    for(std::size_t j = 0; j < old_dimension; ++j)
+    {
+      if(j != index)
+        new_bounds.push_back(at(i, j));
+    }
+  }
+
+  variables.erase(variables.begin() + (index - 1));
+  bounds.swap(new_bounds);
+}
+
+void difference_bound_matrixt::combine(const difference_bound_matrixt &other)
+{
+  const std::size_t offset = size();
+  const std::size_t old_dimension = dimension();
+  const std::size_t new_dimension = old_dimension + other.size();
+
+  // map the indices of the other matrix to the combined one
+  auto to_combined = [offset](std::size_t k) {
+    return k == 0 ? 0 : k + offset;
+  };
+
+  std::vector<boundt> new_bounds(new_dimension * new_dimension, infinity);
+  for(std::size_t i = 0; i < old_dimension; ++i)
+  {
+    std::copy(
+      bounds.begin() + i * old_dimension,
+      bounds.begin() + (i + 1) * old_dimension,
+      new_bounds.begin() + i * new_dimension);
+  }
+
+  for(std::size_t i = 0; i < other.dimension(); ++i)
+  {
+    for(std::size_t j = 0; j < other.dimension(); ++j)
+    {
+      const std::size_t index =
+        to_combined(i) * new_dimension + to_combined(j);
+      new_bounds[index] = std::min(new_bounds[index], other.at(i, j));
+    }
+  }
+
+  for(const auto &variable : other.variables)
+  {
+    PRECONDITION(!index_of(variable).has_value());
+    variables.push_back(variable);
+  }
+  bounds.swap(new_bounds);
+  joins = std::max(joins, other.joins);
+
+  // constraints between the variables of both matrices follow from their
+  // bounds
+  close();
+}
+
+bool difference_bound_matrixt::add_constraint(
+  std::size_t i,
+  std::size_t j,
+  boundt c)
+{
+  PRECONDITION(i != j);
+  PRECONDITION(i < dimension() && j < dimension());
+
+  if(!closed)
+    close();
+
+  if(c >= at(i, j))
+    return true;
+
+  // the constraint closes a cycle of negative weight
+  if(add(at(j, i), c) < 0)
+    return false;
+
+  // A path through the new edge is v_a -> v_i -> v_j -> v_b; as the matrix is
+  // closed, a single pass over all pairs restores closure.
+  const std::size_t n = dimension();
+  std::vector<boundt> to_i(n), from_j(n);
+  for(std::size_t k = 0; k < n; ++k)
+  {
+    to_i[k] = at(k, i);
+    from_j[k] = at(j, k);
+  }
+
+  for(std::size_t a = 0; a < n; ++a)
+  {
+    const boundt via = add(to_i[a], c);
+    if(via == infinity)
+      continue;
+
+    boundt *row = &bounds[a * n];
+    for(std::size_t b = 0; b < n; ++b)
+      row[b] = std::min(row[b], add(via, from_j[b]));
+  }
+
+  return true;
+}
+
+void difference_bound_matrixt::shift(std::size_t i, boundt c)
+{
+  PRECONDITION(i >= 1 && i < dimension());
+
+  const boundt minus_c = c == minimum ? infinity : -c;
+
+  for(std::size_t k = 0; k < dimension(); ++k)
+  {
+    if(k == i)
+      continue;
+
+    const boundt row = add(at(i, k), c);
+    const boundt column = add(at(k, i), minus_c);
+
+    // bounds that are no longer representable are dropped, which may leave
+    // implied bounds behind
+    if(
+      (row == infinity && at(i, k) != infinity) ||
+      (column == infinity && at(k, i) != infinity))
+    {
+      closed = false;
+    }
+
+    at(i, k) = row;
+    at(k, i) = column;
+  }
+}
+
+void difference_bound_matrixt::assign(std::size_t i, std::size_t j, boundt c)
+{
+  PRECONDITION(i != j);
+  PRECONDITION(i >= 1 && i < dimension() && j < dimension());
+
+  if(!closed)
+    close();
+
+  // forget v_i, which keeps the matrix closed
+  for(std::size_t k = 0; k < dimension(); ++k)
+  {
+    if(k != i)
+    {
+      at(i, k) = infinity;
+      at(k, i) = infinity;
+    }
+  }
+
+  if(c == minimum)
+    return;
+
+  const bool consistent = add_constraint(i, j, c) && add_constraint(j, i, -c);
+  INVARIANT(consistent, "an unconstrained variable can take any value");
+}
+
+bool difference_bound_matrixt::join(const difference_bound_matrixt &other)
+{
+  return merge(other, false);
+}
+
+bool difference_bound_matrixt::widen(const difference_bound_matrixt &other)
+{
+  return merge(other, true);
+}
+
+bool difference_bound_matrixt::merge(
+  const difference_bound_matrixt &other,
+  bool widen)
+{
+  // The join of closed matrices is the least upper bound, so the operands are
+  // closed first. The left operand of widening is left as it is, as closing
+  // it could prevent termination.
+  difference_bound_matrixt closed_other;
+  const difference_bound_matrixt *incoming = &other;
+  if(!other.closed)
+  {
+    closed_other = other;
+    closed_other.close();
+    incoming = &closed_other;
+  }
+
+  if(!widen && !closed)
+    close();
+
+  // the variables that the other matrix does not have are unconstrained
+  // there, and thus are dropped
+  std::vector<std::size_t> kept{0};
+  std::vector<std::size_t> other_index{0};
+  for(std::size_t k = 1; k < dimension(); ++k)
+  {
+    const auto index = incoming->index_of(variables[k - 1]);
+    if(index.has_value())
+    {
+      kept.push_back(k);
+      other_index.push_back(*index);
+    }
+  }
+
+  bool changed = kept.size() != dimension();
+
+  const std::size_t new_dimension = kept.size();
+  std::vector<boundt> new_bounds(new_dimension * new_dimension);
+  for(std::size_t a = 0; a < new_dimension; ++a)
+  {
+    for(std::size_t b = 0; b < new_dimension; ++b)
+    {
+      const boundt current = at(kept[a], kept[b]);
+      const boundt incoming_bound =
+        incoming->at(other_index[a], other_index[b]);
+
+      boundt result;
+      if(incoming_bound <= current)
+        result = current;
+      else
+        result = widen ? infinity : incoming_bound;
+
+      changed |= result != current;
+      new_bounds[a * new_dimension + b] = result;
+    }
+  }
+
+  joins = std::max(joins, incoming->joins);
+
+  if(!changed)
+    return false;
+
+  std::vector<irep_idt> new_variables;
+  new_variables.reserve(new_dimension - 1);
+  for(std::size_t a = 1; a < new_dimension; ++a)
+    new_variables.push_back(variables[kept[a] - 1]);
+
+  variables.swap(new_variables);
+  bounds.swap(new_bounds);
+  ++joins;
+
+  if(widen)
+    closed = false;
+
+  return true;
+}
+
+void difference_bound_matrixt::close()
+{
+  const std::size_t n = dimension();
+
+  for(std::size_t k = 0; k < n; ++k)
+  {
+    for(std::size_t i = 0; i < n; ++i)
+    {
+      const boundt via = at(i, k);
+      if(via == infinity)
+        continue;
+
+      boundt *row = &bounds[i * n];
+      const boundt *row_k = &bounds[k * n];
+      for(std::size_t j = 0; j < n; ++j)
+        row[j] = std::min(row[j], add(via, row_k[j]));
+    }
+  }
+
+  for(std::size_t k = 0; k < n; ++k)
+    INVARIANT(at(k, k) == 0, "the constraints are satisfiable");
+
+  closed = true;
+}
+
+void difference_bound_matrixt::output(std::ostream &out) const
+{
+  for(std::size_t i = 0; i < dimension(); ++i)
+  {
+    for(std::size_t j = 0; j < dimension(); ++j)
+    {
+      const boundt bound = at(i, j);
+      if(i == j || bound == infinity)
+        continue;
+
+      if(j == 0)
+        out << variables[i - 1] << " <= " << bound << '\n';
+      else if(i == 0)
+        out << variables[j - 1] << " >= " << -bound << '\n';
+      else
+        out << variables[i - 1] << " - " << variables[j - 1]
+            << " <= " << bound << '\n';
+    }
+  }
+}
@@ -0,0 +1,168 @@
+/*******************************************************************\
+
+ Module: analyses variable-sensitivity
+
+ Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// A difference bound matrix, which represents a conjunction of constraints
+/// of the form `x - y <= c` over integer variables.
+
+#ifndef CPROVER_ANALYSES_VARIABLE_SENSITIVITY_DIFFERENCE_BOUND_MATRIX_H
+#define CPROVER_ANALYSES_VARIABLE_SENSITIVITY_DIFFERENCE_BOUND_MATRIX_H
+
+#include <util/invariant.h>
+#include <util/irep.h>
+#include <util/optional.h>
+
+#include <iosfwd>
+#include <limits>
+#include <vector>
+
+/// A zone: a conjunction of constraints `v_i - v_j <= c` over a set of
+/// integer variables `v_1, ..., v_n`, where the variable `v_0` is the
+/// constant 0 such that `v_i - v_0 <= c` is an upper bound and `v_0 - v_i <= c`
+/// a lower bound of `v_i`.
+///
+/// The bounds are stored in a single row-major array of `(n + 1) * (n + 1)`
+/// entries. The matrix is kept closed, i.e. each entry is the tightest bound
+/// implied by the constraints, so that queries are lookups. Adding a
+/// constraint restores closure in `O(n^2)` rather than the `O(n^3)` of a full
+/// closure. Widening may leave the matrix open; it is closed again by the next
+/// operation that needs it.
+class difference_bound_matrixt
+{
+public:
+  typedef long long boundt;
+
+  /// The bound of an unconstrained difference
+  static constexpr boundt infinity = std::numeric_limits<boundt>::max();
+
+  /// The smallest bound
+  static constexpr boundt minimum = std::numeric_limits<boundt>::min();
+
+  difference_bound_matrixt() : bounds(1, 0)
+  {
+  }
+
+  /// \return the number of variables, not counting the constant 0
+  std::size_t size() const
+  {
+    return variables.size();
+  }
+
+  const std::vector<irep_idt> &get_variables() const
+  {
+    return variables;
+  }
+
+  /// \return the index of \p identifier, which is at least 1 as index 0
+  ///   denotes the constant 0, or an empty optional if it is not a variable of
+  ///   this matrix
+  optionalt<std::size_t> index_of(const irep_idt &identifier) const;
+
+  /// Add \p identifier as an unconstrained variable
+  /// \return the index of the variable
+  std::size_t add_variable(const irep_idt &identifier);
+
+  /// Remove the variable with index \p index, which forgets all constraints
+  /// on it
+  void remove_variable(std::size_t index);
+
+  /// Add the variables and the constraints of \p other, which must not share
+  /// any variable with this matrix
+  void combine(const difference_bound_matrixt &other);
+
+  /// \return the tightest bound `c` such that `v_i - v_j <= c` is implied
+  boundt get(std::size_t i, std::size_t j) const
+  {
+    PRECONDITION(closed);
+    return bounds[i * dimension() + j];
+  }
+
+  /// Add the constraint `v_i - v_j <= c`
+  /// \return false if the constraints have become unsatisfiable, in which
+  ///   case the matrix is left unchanged
+  bool add_constraint(std::size_t i, std::size_t j, boundt c);
+
+  /// Perform the assignment `v_i := v_i + c`
+  void shift(std::size_t i, boundt c);
+
+  /// Perform the assignment `v_i := v_j + c`, where `i != j`
+  void assign(std::size_t i, std::size_t j, boundt c);
+
+  /// Join with \p other, keeping the constraints on the variables that both
+  /// matrices have that hold in both
+  /// \return true if this matrix has changed
+  bool join(const difference_bound_matrixt &other);
+
+  /// Like \ref join, but drop the constraints that \p other weakens, such that
+  /// repeated widening terminates
+  /// \return true if this matrix has changed
+  bool widen(const difference_bound_matrixt &other);
+
+  /// Compute the tightest bounds implied by the constraints
+  void close();
+
+  bool is_closed() const
+  {
+    return closed;
+  }
+
+  /// The number of joins that have changed this matrix, used to delay
+  /// widening
+  std::size_t get_joins() const
+  {
+    return joins;
+  }
+
+  bool operator==(const difference_bound_matrixt &other) const
+  {
+    return variables == other.variables && bounds == other.bounds;
+  }
+
+  /// Print the constraints that are not unbounded
+  void output(std::ostream &out) const;
+
+  /// \return `a + b`, or \ref infinity if either is infinite or the sum is
+  ///   not representable
+  static boundt add(boundt a, boundt b)
+  {
+    if(a == infinity || b == infinity)
+      return infinity;
+    if(b > 0 ? a > infinity - 1 - b : a < minimum - b)
+      return infinity;
+    return a + b;
+  }
+
+private:
+  std::vector<irep_idt> variables;
+
+  /// The bound of `v_i - v_j` is at `i * dimension() + j`
+  std::vector<boundt> bounds;
+
+  bool closed = true;
+  std::size_t joins = 0;
+
+  std::size_t dimension() const
+  {
+    return variables.size() + 1;
+  }
+
+  boundt &at(std::size_t i, std::size_t j)
+  {
+    return bounds[i * dimension() + j];
+  }
+
+  boundt at(std::size_t i, std::size_t j) const
+  {
+    return bounds[i * dimension() + j];
+  }
+
+  /// Join or widen with \p other
+  bool merge(const difference_bound_matrixt &other, bool widen);
+};
+
+#endif // CPROVER_ANALYSES_VARIABLE_SENSITIVITY_DIFFERENCE_BOUND_MATRIX_H
@@ -58,6 +58,10 @@ class interval_abstract_valuet : public abstract_value_objectt
 
   size_t internal_hash() const override;
   bool internal_equality(const abstract_object_pointert &other) const override;
+  bool has_value_equality() const override
+  {
+    return true;
+  }
 
   void output(
     std::ostream &out,
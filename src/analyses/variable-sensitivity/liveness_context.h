@@ -66,6 +66,13 @@ class liveness_contextt : public write_location_contextt
 
   locationt get_location() const;
 
+  /// The assign location is not compared by
+  /// \ref write_location_contextt::internal_equality
+  bool has_value_equality() const override
+  {
+    return false;
+  }
+
 protected:
   CLONE
 
@@ -0,0 +1,848 @@
+/*******************************************************************\
+
+ Module: analyses variable-sensitivity
+
+ Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Relations between integer variables, kept as zones over small packs of
+/// related variables.
+
+#include "packed_zones.h"
+
+#include <analyses/variable-sensitivity/abstract_environment.h>
+#include <analyses/variable-sensitivity/abstract_value_object.h>
+
+#include <util/arith_tools.h>
+#include <util/bitvector_types.h>
+#include <util/interval.h>
+#include <util/std_expr.h>
+
+#include <algorithm>
+#include <ostream>
+
+typedef difference_bound_matrixt::boundt boundt;
+
+/// A zone only holds widened bounds after this many joins, even where the
+/// abstract environment does not ask for widening, so that the ascending
+/// chains of bounds are short
+static const std::size_t joins_before_widening = 16;
+
+optionalt<std::size_t>
+zone_packingt::find_pack(const irep_idt &identifier) const
+{
+  const auto entry = packs.find(identifier);
+  if(entry == packs.end())
+    return {};
+
+  return representative(entry->second);
+}
+
+std::size_t zone_packingt::representative(std::size_t pack) const
+{
+  while(parent[pack] != pack)
+  {
+    parent[pack] = parent[parent[pack]];
+    pack = parent[pack];
+  }
+
+  return pack;
+}
+
+std::size_t zone_packingt::pack_of(const irep_idt &identifier)
+{
+  const auto entry = packs.emplace(identifier, parent.size());
+  if(entry.second)
+  {
+    parent.push_back(parent.size());
+    sizes.push_back(1);
+  }
+
+  return representative(entry.first->second);
+}
+
+bool zone_packingt::unite(const irep_idt &a, const irep_idt &b)
+{
+  std::size_t pack_a = pack_of(a);
+  std::size_t pack_b = pack_of(b);
+
+  if(pack_a == pack_b)
+    return true;
+
+  if(sizes[pack_a] + sizes[pack_b] > maximum_pack_size)
+    return false;
+
+  if(sizes[pack_a] < sizes[pack_b])
+    std::swap(pack_a, pack_b);
+
+  parent[pack_b] = pack_a;
+  sizes[pack_a] += sizes[pack_b];
+  ++current_version;
+
+  return true;
+}
+
+static bool is_tracked_type(const typet &type)
+{
+  return type.id() == ID_signedbv || type.id() == ID_unsignedbv;
+}
+
+/// A term `variable + offset`, where a null variable stands for 0
+struct linear_termt
+{
+  const symbol_exprt *variable;
+  boundt offset;
+};
+
+/// \return the variable that \p expr is, possibly converted to a type that
+///   can represent all its values, or a null pointer
+static const symbol_exprt *to_variable(const exprt &expr)
+{
+  if(!is_tracked_type(expr.type()))
+    return nullptr;
+
+  if(expr.id() == ID_symbol)
+    return &to_symbol_expr(expr);
+
+  if(expr.id() != ID_typecast)
+    return nullptr;
+
+  const exprt &op = to_typecast_expr(expr).op();
+  if(op.id() != ID_symbol || !is_tracked_type(op.type()))
+    return nullptr;
+
+  const auto &from = to_integer_bitvector_type(op.type());
+  const auto &to = to_integer_bitvector_type(expr.type());
+  if(from.smallest() < to.smallest() || from.largest() > to.largest())
+    return nullptr;
+
+  return &to_symbol_expr(op);
+}
+
+static optionalt<boundt> to_offset(const exprt &expr)
+{
+  if(expr.id() != ID_constant || !is_tracked_type(expr.type()))
+    return {};
+
+  // keep clear of the extremes such that offsets can be negated
+  const auto value = numeric_cast<boundt>(expr);
+  if(
+    !value.has_value() || *value == difference_bound_matrixt::minimum ||
+    *value == difference_bound_matrixt::infinity)
+  {
+    return {};
+  }
+
+  return value;
+}
+
+/// \return \p expr as `variable + offset`, if it has that form
+static optionalt<linear_termt> to_linear_term(const exprt &expr)
+{
+  if(!is_tracked_type(expr.type()))
+    return {};
+
+  if(const auto variable = to_variable(expr))
+    return linear_termt{variable, 0};
+
+  if(const auto offset = to_offset(expr))
+    return linear_termt{nullptr, *offset};
+
+  if(expr.id() == ID_plus && expr.operands().size() == 2)
+  {
+    const exprt &op0 = to_binary_expr(expr).op0();
+    const exprt &op1 = to_binary_expr(expr).op1();
+
+    if(const auto variable = to_variable(op0))
+    {
+      if(const auto offset = to_offset(op1))
+        return linear_termt{variable, *offset};
+    }
+    else if(const auto variable = to_variable(op1))
+    {
+      if(const auto offset = to_offset(op0))
+        return linear_termt{variable, *offset};
+    }
+  }
+  else if(expr.id() == ID_minus)
+  {
+    const auto variable = to_variable(to_minus_expr(expr).op0());
+    const auto offset = to_offset(to_minus_expr(expr).op1());
+    if(variable && offset.has_value())
+      return linear_termt{variable, -*offset};
+  }
+
+  return {};
+}
+
+static boundt to_bound(const mp_integer &value)
+{
+  const auto bound = numeric_castt<boundt>{}(value);
+  if(!bound.has_value() || *bound == difference_bound_matrixt::minimum)
+    return difference_bound_matrixt::infinity;
+  return *bound;
+}
+
+/// \return the upper bound of \p variable and the upper bound of its negation,
+///   from its type and its value in \p environment
+static std::pair<boundt, boundt> environment_bounds(
+  const symbol_exprt &variable,
+  const abstract_environmentt &environment,
+  const namespacet &ns)
+{
+  const auto &type = to_integer_bitvector_type(variable.type());
+  boundt upper = to_bound(type.largest());
+  boundt minus_lower = to_bound(-type.smallest());
+
+  const auto value = std::dynamic_pointer_cast<const abstract_value_objectt>(
+    environment.eval(variable, ns)->unwrap_context());
+  if(value && !value->is_top() && !value->is_bottom())
+  {
+    const constant_interval_exprt interval = value->to_interval();
+
+    if(const auto value_upper = numeric_cast<mp_integer>(interval.get_upper()))
+      upper = std::min(upper, to_bound(*value_upper));
+    if(const auto value_lower = numeric_cast<mp_integer>(interval.get_lower()))
+      minus_lower = std::min(minus_lower, to_bound(-*value_lower));
+  }
+
+  return {upper, minus_lower};
+}
+
+void packed_zonest::normalise(const zone_packingt &packing)
+{
+  if(version == packing.version())
+    return;
+
+  std::map<std::size_t, zone_ptrt> normalised;
+  for(const auto &entry : zones)
+  {
+    zone_ptrt &zone = normalised[packing.representative(entry.first)];
+    if(!zone)
+    {
+      zone = entry.second;
+    }
+    else
+    {
+      auto combined = std::make_shared<difference_bound_matrixt>(*zone);
+      combined->combine(*entry.second);
+      zone = std::move(combined);
+    }
+  }
+
+  zones.swap(normalised);
+  version = packing.version();
+}
+
+difference_bound_matrixt &packed_zonest::mutable_zone(std::size_t pack)
+{
+  zone_ptrt &zone = zones[pack];
+
+  if(!zone)
+    zone = std::make_shared<difference_bound_matrixt>();
+  else if(zone.use_count() > 1)
+    zone = std::make_shared<difference_bound_matrixt>(*zone);
+
+  return *zone;
+}
+
+std::size_t packed_zonest::ensure_variable(
+  difference_bound_matrixt &zone,
+  const symbol_exprt &variable,
+  const abstract_environmentt &environment,
+  const namespacet &ns)
+{
+  const auto existing = zone.index_of(variable.get_identifier());
+  if(existing.has_value())
+    return *existing;
+
+  const std::size_t index = zone.add_variable(variable.get_identifier());
+  const auto bounds = environment_bounds(variable, environment, ns);
+
+  // the variable was unconstrained, and its bounds are consistent
+  const bool consistent = zone.add_constraint(index, 0, bounds.first) &&
+                          zone.add_constraint(0, index, bounds.second);
+  INVARIANT(consistent, "the value of a variable is not empty");
+
+  return index;
+}
+
+std::pair<const difference_bound_matrixt *, std::size_t>
+packed_zonest::find_variable(
+  const irep_idt &identifier,
+  const zone_packingt &packing) const
+{
+  const auto pack = packing.find_pack(identifier);
+  if(!pack.has_value())
+    return {nullptr, 0};
+
+  for(const auto &entry : zones)
+  {
+    // zones are by pack as of an earlier version when the packing has changed
+    const std::size_t entry_pack = version == packing.version()
+                                     ? entry.first
+                                     : packing.representative(entry.first);
+    if(entry_pack != *pack)
+      continue;
+
+    const auto index = entry.second->index_of(identifier);
+    if(index.has_value())
+      return {entry.second.get(), *index};
+  }
+
+  return {nullptr, 0};
+}
+
+std::pair<boundt, boundt> packed_zonest::difference_bounds(
+  const symbol_exprt *a,
+  const symbol_exprt *b,
+  const abstract_environmentt &environment,
+  const zone_packingt &packing,
+  const namespacet &ns) const
+{
+  if(!a && !b)
+    return {0, 0};
+
+  if(a && b && a->get_identifier() == b->get_identifier())
+    return {0, 0};
+
+  boundt a_minus_b = difference_bound_matrixt::infinity;
+  boundt b_minus_a = difference_bound_matrixt::infinity;
+
+  // the bounds that the zones give
+  const auto in_a = a ? find_variable(a->get_identifier(), packing)
+                      : std::make_pair(nullptr, std::size_t{0});
+  const auto in_b = b ? find_variable(b->get_identifier(), packing)
+                      : std::make_pair(nullptr, std::size_t{0});
+  const difference_bound_matrixt *zone =
+    !a ? in_b.first : !b ? in_a.first : in_a.first == in_b.first ? in_a.first
+                                                                 : nullptr;
+  if(zone)
+  {
+    difference_bound_matrixt closed_zone;
+    if(!zone->is_closed())
+    {
+      closed_zone = *zone;
+      closed_zone.close();
+      zone = &closed_zone;
+    }
+
+    a_minus_b = zone->get(in_a.second, in_b.second);
+    b_minus_a = zone->get(in_b.second, in_a.second);
+  }
+
+  // the bounds that follow from the bounds of each variable
+  if(a && b)
+  {
+    const auto bounds_a =
+      difference_bounds(a, nullptr, environment, packing, ns);
+    const auto bounds_b =
+      difference_bounds(b, nullptr, environment, packing, ns);
+    a_minus_b = std::min(
+      a_minus_b,
+      difference_bound_matrixt::add(bounds_a.first, bounds_b.second));
+    b_minus_a = std::min(
+      b_minus_a,
+      difference_bound_matrixt::add(bounds_b.first, bounds_a.second));
+  }
+  else
+  {
+    const auto bounds = environment_bounds(a ? *a : *b, environment, ns);
+    a_minus_b = std::min(a_minus_b, a ? bounds.first : bounds.second);
+    b_minus_a = std::min(b_minus_a, a ? bounds.second : bounds.first);
+  }
+
+  return {a_minus_b, b_minus_a};
+}
+
+/// \return true if evaluating \p term in \p type cannot overflow
+static bool fits(
+  const linear_termt &term,
+  const typet &type,
+  const std::pair<boundt, boundt> &variable_bounds)
+{
+  if(!term.variable || term.offset == 0)
+    return true;
+
+  if(
+    variable_bounds.first == difference_bound_matrixt::infinity ||
+    variable_bounds.second == difference_bound_matrixt::infinity)
+  {
+    return false;
+  }
+
+  const auto &bitvector_type = to_integer_bitvector_type(type);
+  const mp_integer upper = mp_integer{variable_bounds.first} + term.offset;
+  const mp_integer lower = term.offset - mp_integer{variable_bounds.second};
+
+  return upper <= bitvector_type.largest() &&
+         lower >= bitvector_type.smallest();
+}
+
+void packed_zonest::forget(
+  const irep_idt &identifier,
+  const zone_packingt &packing)
+{
+  if(zones.empty())
+    return;
+
+  const auto pack = packing.find_pack(identifier);
+  if(!pack.has_value())
+    return;
+
+  normalise(packing);
+
+  const auto entry = zones.find(*pack);
+  if(entry == zones.end())
+    return;
+
+  const auto index = entry->second->index_of(identifier);
+  if(!index.has_value())
+    return;
+
+  // a zone of a single variable does not relate anything
+  if(entry->second->size() <= 2)
+    zones.erase(entry);
+  else
+    mutable_zone(*pack).remove_variable(*index);
+}
+
+void packed_zonest::assign(
+  const symbol_exprt &lhs,
+  const exprt &rhs,
+  const abstract_environmentt &environment,
+  zone_packingt &packing,
+  const namespacet &ns)
+{
+  const irep_idt &identifier = lhs.get_identifier();
+  const auto term = to_linear_term(rhs);
+
+  if(
+    !is_tracked_type(lhs.type()) || !term.has_value() || !term->variable ||
+    !fits(
+      *term,
+      rhs.type(),
+      difference_bounds(term->variable, nullptr, environment, packing, ns)))
+  {
+    forget(identifier, packing);
+    return;
+  }
+
+  const symbol_exprt &variable = *term->variable;
+
+  if(variable.get_identifier() == identifier)
+  {
+    const auto pack = packing.find_pack(identifier);
+    if(!pack.has_value())
+      return;
+
+    normalise(packing);
+
+    const auto entry = zones.find(*pack);
+    if(entry == zones.end())
+      return;
+
+    const auto index = entry->second->index_of(identifier);
+    if(index.has_value())
+      mutable_zone(*pack).shift(*index, term->offset);
+
+    return;
+  }
+
+  forget(identifier, packing);
+
+  if(!packing.unite(identifier, variable.get_identifier()))
+    return;
+
+  normalise(packing);
+
+  difference_bound_matrixt &zone =
+    mutable_zone(*packing.find_pack(identifier));
+  const std::size_t source = ensure_variable(zone, variable, environment, ns);
+  const std::size_t target = zone.add_variable(identifier);
+  zone.assign(target, source, term->offset);
+}
+
+bool packed_zonest::add_constraint(
+  const symbol_exprt *a,
+  const symbol_exprt *b,
+  boundt c,
+  const abstract_environmentt &environment,
+  zone_packingt &packing,
+  const namespacet &ns)
+{
+  if(c == difference_bound_matrixt::infinity)
+    return true;
+
+  if(!a && !b)
+    return c >= 0;
+
+  if(a && b && a->get_identifier() == b->get_identifier())
+    return c >= 0;
+
+  if(a && b)
+  {
+    if(!packing.unite(a->get_identifier(), b->get_identifier()))
+      return true;
+
+    normalise(packing);
+
+    difference_bound_matrixt &zone =
+      mutable_zone(*packing.find_pack(a->get_identifier()));
+    const std::size_t i = ensure_variable(zone, *a, environment, ns);
+    const std::size_t j = ensure_variable(zone, *b, environment, ns);
+    return zone.add_constraint(i, j, c);
+  }
+
+  // a bound of a single variable is only kept when the variable is related
+  // to others
+  const irep_idt &identifier = a ? a->get_identifier() : b->get_identifier();
+  const auto pack = packing.find_pack(identifier);
+  if(!pack.has_value())
+    return true;
+
+  normalise(packing);
+
+  const auto entry = zones.find(*pack);
+  if(entry == zones.end())
+    return true;
+
+  const auto index = entry->second->index_of(identifier);
+  if(!index.has_value())
+    return true;
+
+  difference_bound_matrixt &zone = mutable_zone(*pack);
+  return a ? zone.add_constraint(*index, 0, c)
+           : zone.add_constraint(0, *index, c);
+}
+
+static bool is_relation(const exprt &expr)
+{
+  return (expr.id() == ID_lt || expr.id() == ID_le || expr.id() == ID_gt ||
+          expr.id() == ID_ge || expr.id() == ID_equal ||
+          expr.id() == ID_notequal) &&
+         expr.operands().size() == 2;
+}
+
+static irep_idt negate_relation(const irep_idt &id)
+{
+  if(id == ID_lt)
+    return ID_ge;
+  else if(id == ID_le)
+    return ID_gt;
+  else if(id == ID_gt)
+    return ID_le;
+  else if(id == ID_ge)
+    return ID_lt;
+  else if(id == ID_equal)
+    return ID_notequal;
+  else
+    return ID_equal;
+}
+
+/// The operands of a relation as linear terms, and the difference of their
+/// offsets
+struct linear_relationt
+{
+  linear_termt lhs;
+  linear_termt rhs;
+  boundt offset;
+};
+
+static optionalt<linear_relationt> to_linear_relation(const exprt &expr)
+{
+  const auto &relation = to_binary_relation_expr(expr);
+  const auto lhs = to_linear_term(relation.lhs());
+  const auto rhs = to_linear_term(relation.rhs());
+  if(!lhs.has_value() || !rhs.has_value() || (!lhs->variable && !rhs->variable))
+    return {};
+
+  const boundt offset =
+    difference_bound_matrixt::add(lhs->offset, -rhs->offset);
+  if(
+    offset == difference_bound_matrixt::infinity ||
+    offset == difference_bound_matrixt::minimum)
+  {
+    return {};
+  }
+
+  return linear_relationt{*lhs, *rhs, offset};
+}
+
+bool packed_zonest::assume(
+  const exprt &condition,
+  const abstract_environmentt &environment,
+  zone_packingt &packing,
+  const namespacet &ns)
+{
+  if(condition.id() == ID_and)
+  {
+    for(const auto &op : condition.operands())
+    {
+      if(!assume(op, environment, packing, ns))
+        return false;
+    }
+
+    return true;
+  }
+
+  if(condition.id() == ID_not)
+  {
+    const exprt &op = to_not_expr(condition).op();
+    if(!is_relation(op))
+      return true;
+
+    return assume(
+      binary_relation_exprt(
+        to_binary_relation_expr(op).lhs(),
+        negate_relation(op.id()),
+        to_binary_relation_expr(op).rhs()),
+      environment,
+      packing,
+      ns);
+  }
+
+  if(!is_relation(condition) || condition.id() == ID_notequal)
+    return true;
+
+  const auto relation = to_linear_relation(condition);
+  if(!relation.has_value())
+    return true;
+
+  const auto &lhs = relation->lhs;
+  const auto &rhs = relation->rhs;
+  const auto &operands = to_binary_relation_expr(condition);
+  if(
+    !fits(
+      lhs,
+      operands.lhs().type(),
+      difference_bounds(lhs.variable, nullptr, environment, packing, ns)) ||
+    !fits(
+      rhs,
+      operands.rhs().type(),
+      difference_bounds(rhs.variable, nullptr, environment, packing, ns)))
+  {
+    return true;
+  }
+
+  // lhs - rhs = x - y + d, where x and y are the variables of lhs and rhs
+  const boundt d = relation->offset;
+  const irep_idt &id = condition.id();
+
+  if(id == ID_le || id == ID_equal)
+  {
+    if(!add_constraint(
+         lhs.variable, rhs.variable, -d, environment, packing, ns))
+    {
+      return false;
+    }
+  }
+
+  if(id == ID_ge || id == ID_equal)
+  {
+    if(!add_constraint(rhs.variable, lhs.variable, d, environment, packing, ns))
+      return false;
+  }
+
+  if(id == ID_lt)
+  {
+    return add_constraint(
+      lhs.variable, rhs.variable, -d - 1, environment, packing, ns);
+  }
+
+  if(id == ID_gt)
+  {
+    return add_constraint(
+      rhs.variable,
+      lhs.variable,
+      difference_bound_matrixt::add(d, -1),
+      environment,
+      packing,
+      ns);
+  }
+
+  return true;
+}
+
+tvt packed_zonest::evaluate(
+  const exprt &condition,
+  const abstract_environmentt &environment,
+  const zone_packingt &packing,
+  const namespacet &ns) const
+{
+  if(zones.empty())
+    return tvt::unknown();
+
+  if(condition.id() == ID_not)
+    return !evaluate(to_not_expr(condition).op(), environment, packing, ns);
+
+  if(!is_relation(condition))
+    return tvt::unknown();
+
+  const auto relation = to_linear_relation(condition);
+  if(!relation.has_value())
+    return tvt::unknown();
+
+  const auto &lhs = relation->lhs;
+  const auto &rhs = relation->rhs;
+
+  // comparisons of variables that are in no zone are left to the abstract
+  // environment
+  if(
+    (!lhs.variable ||
+     !find_variable(lhs.variable->get_identifier(), packing).first) &&
+    (!rhs.variable ||
+     !find_variable(rhs.variable->get_identifier(), packing).first))
+  {
+    return tvt::unknown();
+  }
+
+  const auto &operands = to_binary_relation_expr(condition);
+  if(
+    !fits(
+      lhs,
+      operands.lhs().type(),
+      difference_bounds(lhs.variable, nullptr, environment, packing, ns)) ||
+    !fits(
+      rhs,
+      operands.rhs().type(),
+      difference_bounds(rhs.variable, nullptr, environment, packing, ns)))
+  {
+    return tvt::unknown();
+  }
+
+  // upper bounds of lhs - rhs and rhs - lhs
+  const auto bounds = difference_bounds(
+    lhs.variable, rhs.variable, environment, packing, ns);
+  const boundt lhs_minus_rhs =
+    difference_bound_matrixt::add(bounds.first, relation->offset);
+  const boundt rhs_minus_lhs =
+    difference_bound_matrixt::add(bounds.second, -relation->offset);
+
+  const irep_idt &id = condition.id();
+  if(id == ID_le)
+  {
+    if(lhs_minus_rhs <= 0)
+      return tvt(true);
+    if(rhs_minus_lhs <= -1)
+      return tvt(false);
+  }
+  else if(id == ID_lt)
+  {
+    if(lhs_minus_rhs <= -1)
+      return tvt(true);
+    if(rhs_minus_lhs <= 0)
+      return tvt(false);
+  }
+  else if(id == ID_ge)
+  {
+    if(rhs_minus_lhs <= 0)
+      return tvt(true);
+    if(lhs_minus_rhs <= -1)
+      return tvt(false);
+  }
+  else if(id == ID_gt)
+  {
+    if(rhs_minus_lhs <= -1)
+      return tvt(true);
+    if(lhs_minus_rhs <= 0)
+      return tvt(false);
+  }
+  else
+  {
+    tvt equal = tvt::unknown();
+    if(lhs_minus_rhs <= 0 && rhs_minus_lhs <= 0)
+      equal = tvt(true);
+    else if(lhs_minus_rhs <= -1 || rhs_minus_lhs <= -1)
+      equal = tvt(false);
+
+    return id == ID_equal ? equal : !equal;
+  }
+
+  return tvt::unknown();
+}
+
+bool packed_zonest::merge(
+  const packed_zonest &other,
+  zone_packingt &packing,
+  bool widen)
+{
+  normalise(packing);
+
+  packed_zonest normalised_other;
+  const packed_zonest *incoming = &other;
+  if(other.version != packing.version())
+  {
+    normalised_other = other;
+    normalised_other.normalise(packing);
+    incoming = &normalised_other;
+  }
+
+  bool changed = false;
+  for(auto entry = zones.begin(); entry != zones.end();)
+  {
+    const auto other_entry = incoming->zones.find(entry->first);
+
+    // there are no relations between these variables in the other state
+    if(other_entry == incoming->zones.end())
+    {
+      entry = zones.erase(entry);
+      changed = true;
+      continue;
+    }
+
+    if(entry->second == other_entry->second)
+    {
+      ++entry;
+      continue;
+    }
+
+    auto zone = std::make_shared<difference_bound_matrixt>(*entry->second);
+    const bool zone_changed =
+      widen || zone->get_joins() >= joins_before_widening
+        ? zone->widen(*other_entry->second)
+        : zone->join(*other_entry->second);
+
+    if(!zone_changed)
+    {
+      ++entry;
+      continue;
+    }
+
+    changed = true;
+    if(zone->size() < 2)
+    {
+      entry = zones.erase(entry);
+    }
+    else
+    {
+      entry->second = std::move(zone);
+      ++entry;
+    }
+  }
+
+  return changed;
+}
+
+void packed_zonest::output(std::ostream &out) const
+{
+  for(const auto &entry : zones)
+    entry.second->output(out);
+}
+
+bool packed_zonest::operator==(const packed_zonest &other) const
+{
+  return zones.size() == other.zones.size() &&
+         std::equal(
+           zones.begin(),
+           zones.end(),
+           other.zones.begin(),
+           [](
+             const std::pair<const std::size_t, zone_ptrt> &a,
+             const std::pair<const std::size_t, zone_ptrt> &b) {
+             return a.first == b.first &&
+                    (a.second == b.second || *a.second == *b.second);
+           });
+}
@@ -0,0 +1,179 @@
+/*******************************************************************\
+
+ Module: analyses variable-sensitivity
+
+ Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Relations between integer variables, kept as zones over small packs of
+/// related variables.
+
+#ifndef CPROVER_ANALYSES_VARIABLE_SENSITIVITY_PACKED_ZONES_H
+#define CPROVER_ANALYSES_VARIABLE_SENSITIVITY_PACKED_ZONES_H
+
+#include <analyses/variable-sensitivity/difference_bound_matrix.h>
+
+#include <util/threeval.h>
+
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+class abstract_environmentt;
+class exprt;
+class namespacet;
+class symbol_exprt;
+
+/// Partitions the variables into packs of variables that are related by the
+/// program. Two variables are put into the same pack when an assignment or a
+/// condition relates them, unless the pack would grow beyond the maximum
+/// size, such that each zone stays small however many variables a function
+/// has. Packs are only ever merged; the version changes each time they are.
+class zone_packingt
+{
+public:
+  explicit zone_packingt(std::size_t maximum_pack_size)
+    : maximum_pack_size(maximum_pack_size)
+  {
+  }
+
+  /// \return the pack of \p identifier, or an empty optional if the variable
+  ///   has not been related to any other variable
+  optionalt<std::size_t> find_pack(const irep_idt &identifier) const;
+
+  /// \return the pack that \p pack has been merged into
+  std::size_t representative(std::size_t pack) const;
+
+  /// Put \p a and \p b into the same pack
+  /// \return false if the pack would be too large
+  bool unite(const irep_idt &a, const irep_idt &b);
+
+  std::size_t version() const
+  {
+    return current_version;
+  }
+
+private:
+  const std::size_t maximum_pack_size;
+
+  std::unordered_map<irep_idt, std::size_t> packs;
+  mutable std::vector<std::size_t> parent;
+  std::vector<std::size_t> sizes;
+  std::size_t current_version = 0;
+
+  std::size_t pack_of(const irep_idt &identifier);
+};
+
+/// The relations between the integer variables of an abstract environment.
+/// There is one zone per pack of variables (see \ref zone_packingt) that have
+/// been related; variables that are not in any zone are only described by the
+/// abstract environment. Zones are shared between copies until they are
+/// modified.
+class packed_zonest
+{
+public:
+  typedef difference_bound_matrixt::boundt boundt;
+
+  bool empty() const
+  {
+    return zones.empty();
+  }
+
+  void clear()
+  {
+    zones.clear();
+  }
+
+  /// Forget all relations of \p identifier
+  void forget(const irep_idt &identifier, const zone_packingt &packing);
+
+  /// Update the relations for the assignment of \p rhs to \p lhs
+  /// \param lhs: the assigned variable
+  /// \param rhs: the assigned expression
+  /// \param environment: the environment before the assignment
+  /// \param packing: the packs of variables
+  /// \param ns: the namespace
+  void assign(
+    const symbol_exprt &lhs,
+    const exprt &rhs,
+    const abstract_environmentt &environment,
+    zone_packingt &packing,
+    const namespacet &ns);
+
+  /// Add the relations that \p condition implies
+  /// \return false if \p condition cannot hold
+  bool assume(
+    const exprt &condition,
+    const abstract_environmentt &environment,
+    zone_packingt &packing,
+    const namespacet &ns);
+
+  /// Decide the comparison \p condition using the relations
+  /// \return true or false if the relations decide \p condition, unknown
+  ///   otherwise
+  tvt evaluate(
+    const exprt &condition,
+    const abstract_environmentt &environment,
+    const zone_packingt &packing,
+    const namespacet &ns) const;
+
+  /// Join with \p other, or widen if \p widen is set
+  /// \return true if the relations have changed
+  bool merge(const packed_zonest &other, zone_packingt &packing, bool widen);
+
+  void output(std::ostream &out) const;
+
+  bool operator==(const packed_zonest &other) const;
+
+private:
+  typedef std::shared_ptr<difference_bound_matrixt> zone_ptrt;
+
+  /// The zones by pack, where packs are as of \ref version
+  std::map<std::size_t, zone_ptrt> zones;
+  std::size_t version = 0;
+
+  /// Combine the zones of packs that have been merged since \ref version
+  void normalise(const zone_packingt &packing);
+
+  /// \return the zone of \p pack, which is created if there is none and
+  ///   copied if it is shared
+  difference_bound_matrixt &mutable_zone(std::size_t pack);
+
+  /// Add \p variable to \p zone if it is not in it, bounded by its value in
+  /// \p environment
+  /// \return the index of \p variable in \p zone
+  static std::size_t ensure_variable(
+    difference_bound_matrixt &zone,
+    const symbol_exprt &variable,
+    const abstract_environmentt &environment,
+    const namespacet &ns);
+
+  /// \return the zone that has \p identifier and its index, or a null
+  ///   pointer if \p identifier is not in any zone
+  std::pair<const difference_bound_matrixt *, std::size_t>
+  find_variable(const irep_idt &identifier, const zone_packingt &packing) const;
+
+  /// \return the upper bounds of `a - b` and of `b - a`, where a missing
+  ///   variable stands for 0
+  std::pair<boundt, boundt> difference_bounds(
+    const symbol_exprt *a,
+    const symbol_exprt *b,
+    const abstract_environmentt &environment,
+    const zone_packingt &packing,
+    const namespacet &ns) const;
+
+  /// Add the constraint `a - b <= c`, where a missing variable stands for 0
+  /// \return false if the constraints cannot hold
+  bool add_constraint(
+    const symbol_exprt *a,
+    const symbol_exprt *b,
+    boundt c,
+    const abstract_environmentt &environment,
+    zone_packingt &packing,
+    const namespacet &ns);
+};
+
+#endif // CPROVER_ANALYSES_VARIABLE_SENSITIVITY_PACKED_ZONES_H
@@ -66,7 +66,8 @@ bool ai_three_way_merget::visit_edge_function_call(
 
   // Handle the function call recursively
   {
-    working_sett catch_working_set; // The starting trace for the next fixpoint
+    // The starting trace for the next fixpoint
+    working_sett catch_working_set = make_working_set();
 
     // Do the edge from the call site to the beginning of the function
     // (This will compute p_callee_start but that is OK)
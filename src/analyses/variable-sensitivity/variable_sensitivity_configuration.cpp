@@ -49,6 +49,18 @@ vsd_configt vsd_configt::from_options(const optionst &options)
 
   config.maximum_array_index = configure_max_array_size(options);
 
+  config.relations = configure_relations(options);
+  if(options.is_set("max-pack-size"))
+  {
+    config.maximum_pack_size = options.get_unsigned_int_option("max-pack-size");
+    if(config.maximum_pack_size < 2)
+    {
+      throw invalid_command_line_argument_exceptiont{
+        "a zone must relate at least two variables",
+        "--vsd-max-pack-size"};
+    }
+  }
+
   return config;
 }
 
@@ -117,6 +129,9 @@ const vsd_configt::option_size_mappingt
 const vsd_configt::option_mappingt vsd_configt::union_option_mappings = {
   {"top-bottom", UNION_INSENSITIVE}};
 
+const std::map<std::string, relationst> vsd_configt::relations_option_mappings =
+  {{"none", relationst::none}, {"zones", relationst::zones}};
+
 template <class mappingt>
 invalid_command_line_argument_exceptiont invalid_argument(
   const std::string &option_name,
@@ -165,6 +180,20 @@ size_t vsd_configt::configure_max_array_size(const optionst &options)
   return option_to_size(options, "arrays", array_option_size_mappings);
 }
 
+relationst vsd_configt::configure_relations(const optionst &options)
+{
+  const auto argument = options.get_option("relations");
+
+  if(argument.empty())
+    return relationst::none;
+
+  auto selected = relations_option_mappings.find(argument);
+  if(selected == relations_option_mappings.end())
+    throw invalid_argument("relations", argument, relations_option_mappings);
+
+  return selected->second;
+}
+
 size_t vsd_configt::option_to_size(
   const optionst &options,
   const std::string &option_name,
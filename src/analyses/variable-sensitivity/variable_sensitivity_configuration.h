@@ -41,6 +41,15 @@ enum class flow_sensitivityt
   insensitive
 };
 
+/// The relations between variables that are tracked in addition to the
+/// values of each variable
+enum class relationst
+{
+  none,
+  /// Bounds on the differences of integer variables, see \ref packed_zonest
+  zones
+};
+
 struct vsd_configt
 {
   ABSTRACT_OBJECT_TYPET value_abstract_type;
@@ -53,6 +62,11 @@ struct vsd_configt
 
   size_t maximum_array_index = 0;
 
+  relationst relations = relationst::none;
+
+  /// The largest number of variables that a zone relates
+  size_t maximum_pack_size = 8;
+
   struct
   {
     bool liveness;
@@ -89,6 +103,8 @@ struct vsd_configt
 
   static size_t configure_max_array_size(const optionst &options);
 
+  static relationst configure_relations(const optionst &options);
+
   static size_t option_to_size(
     const optionst &options,
     const std::string &option_name,
@@ -100,6 +116,7 @@ struct vsd_configt
   static const option_mappingt array_option_mappings;
   static const option_size_mappingt array_option_size_mappings;
   static const option_mappingt union_option_mappings;
+  static const std::map<std::string, relationst> relations_option_mappings;
 };
 
 #endif // CPROVER_ANALYSES_VARIABLE_SENSITIVITY_VARIABLE_SENSITIVITY_CONFIGURATION_H // NOLINT(*)
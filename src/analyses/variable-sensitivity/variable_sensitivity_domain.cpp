@@ -62,7 +62,8 @@ void variable_sensitivity_domaint::transform(
     abstract_object_pointert rhs =
       abstract_state.eval(instruction.assign_rhs(), ns)
         ->write_location_context(from);
-    abstract_state.assign(instruction.assign_lhs(), rhs, ns);
+    abstract_state.assign(
+      instruction.assign_lhs(), instruction.assign_rhs(), rhs, ns);
   }
   break;
 
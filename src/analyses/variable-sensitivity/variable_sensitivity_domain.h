@@ -78,6 +78,8 @@
   "(vsd-array-max-elements):"                                                  \
   "(vsd-pointers):"                                                            \
   "(vsd-unions):"                                                              \
+  "(vsd-relations):"                                                           \
+  "(vsd-max-pack-size):"                                                       \
   "(vsd-flow-insensitive)"                                                     \
   "(vsd-data-dependencies)"                                                    \
   "(vsd-liveness)"                                                             \
@@ -95,6 +97,10 @@
   " --vsd-pointers               pointer sensitive analysis - "                \
   "top-bottom|constants|value-set\n" /* NOLINT(whitespace/line_length) */      \
   " --vsd-unions                 union sensitive analysis - top-bottom\n"      \
+  " --vsd-relations              relations between integer variables - "       \
+  "none|zones\n" /* NOLINT(whitespace/line_length) */                          \
+  " --vsd-max-pack-size          the largest number of variables that a zone " \
+  "relates - defaults to 8\n" /* NOLINT(whitespace/line_length) */             \
   " --vsd-flow-insensitive       disables flow sensitivity\n"                  \
   " --vsd-data-dependencies      track data dependencies\n"                    \
   " --vsd-liveness               track variable liveness\n"                    \
@@ -108,6 +114,9 @@
   options.set_option("array-max-elements", cmdline.get_value("vsd-array-max-elements")); /* NOLINT(whitespace/line_length) */ \
   options.set_option("structs", cmdline.get_value("vsd-structs"));             \
   options.set_option("unions", cmdline.get_value("vsd-unions"));               \
+  options.set_option("relations", cmdline.get_value("vsd-relations"));         \
+  if(cmdline.isset("vsd-max-pack-size"))                                       \
+    options.set_option("max-pack-size", cmdline.get_value("vsd-max-pack-size")); /* NOLINT(whitespace/line_length) */ \
   options.set_option("flow-insensitive", cmdline.isset("vsd-flow-insensitive")); /* NOLINT(whitespace/line_length) */ \
   options.set_option("data-dependencies", cmdline.isset("vsd-data-dependencies")); /* NOLINT(whitespace/line_length) */ \
   options.set_option("liveness", cmdline.isset("vsd-liveness")); /* NOLINT(whitespace/line_length) */ \
@@ -315,6 +324,14 @@ struct get_domain_statisticst<variable_sensitivity_domaint>
     total_statistics.number_of_arrays += statistics.number_of_arrays;
     total_statistics.number_of_structs += statistics.number_of_arrays;
     total_statistics.objects_memory_usage += statistics.objects_memory_usage;
+    // The merge counts are kept by the object factory that all domains share
+    total_statistics.number_of_merges = statistics.number_of_merges;
+    total_statistics.number_of_merge_shortcuts =
+      statistics.number_of_merge_shortcuts;
+    total_statistics.number_of_merge_allocations =
+      statistics.number_of_merge_allocations;
+    total_statistics.number_of_shared_objects =
+      statistics.number_of_shared_objects;
   }
 
   void print(std::ostream &out) const
@@ -333,6 +350,13 @@ struct get_domain_statisticst<variable_sensitivity_domaint>
         << "  Number of single value intervals: "
         << total_statistics.number_of_single_value_intervals << '\n'
         << "  Number of globals: " << total_statistics.number_of_globals << '\n'
+        << "  Number of merges: " << total_statistics.number_of_merges << '\n'
+        << "  Number of merges of identical objects: "
+        << total_statistics.number_of_merge_shortcuts << '\n'
+        << "  Number of merges allocating a new object: "
+        << total_statistics.number_of_merge_allocations << '\n'
+        << "  Number of objects shared by interning: "
+        << total_statistics.number_of_shared_objects << '\n'
         << "<< End Variable Sensitivity Domain Statistics >>\n";
   }
 };
@@ -10,6 +10,8 @@
 #include "liveness_context.h"
 #include "value_set_pointer_abstract_object.h"
 
+#include <typeinfo>
+
 template <class context_classt>
 abstract_object_pointert
 create_context_abstract_object(const abstract_object_pointert &abstract_object)
@@ -206,3 +208,49 @@ variable_sensitivity_object_factoryt::wrap_with_context(
 {
   return wrap_with_context_object(abstract_object, configuration);
 }
+
+abstract_object_pointert variable_sensitivity_object_factoryt::intern(
+  const abstract_object_pointert &object)
+{
+  if(!object->has_value_equality())
+    return object;
+
+  auto &bucket = unique_table[object->internal_hash()];
+
+  for(auto it = bucket.begin(); it != bucket.end();)
+  {
+    abstract_object_pointert candidate = it->lock();
+    if(candidate == nullptr)
+    {
+      it = bucket.erase(it);
+      continue;
+    }
+
+    if(
+      candidate == object ||
+      (typeid(*candidate) == typeid(*object) &&
+       candidate->is_top() == object->is_top() &&
+       candidate->is_bottom() == object->is_bottom() &&
+       candidate->type() == object->type() &&
+       candidate->internal_equality(object)))
+    {
+      if(candidate != object)
+        ++intern_hits;
+      return candidate;
+    }
+
+    ++it;
+  }
+
+  bucket.push_back(object);
+  return object;
+}
+
+void variable_sensitivity_object_factoryt::get_statistics(
+  abstract_object_statisticst &statistics) const
+{
+  statistics.number_of_merges = merges;
+  statistics.number_of_merge_shortcuts = merge_shortcuts;
+  statistics.number_of_merge_allocations = merge_allocations;
+  statistics.number_of_shared_objects = intern_hits;
+}
@@ -20,6 +20,7 @@
 #include <analyses/variable-sensitivity/data_dependency_context.h>
 #include <analyses/variable-sensitivity/full_struct_abstract_object.h>
 #include <analyses/variable-sensitivity/interval_abstract_value.h>
+#include <analyses/variable-sensitivity/packed_zones.h>
 #include <analyses/variable-sensitivity/two_value_array_abstract_object.h>
 #include <analyses/variable-sensitivity/two_value_pointer_abstract_object.h>
 #include <analyses/variable-sensitivity/two_value_struct_abstract_object.h>
@@ -30,6 +31,9 @@
 
 #include "abstract_object.h"
 
+#include <unordered_map>
+#include <vector>
+
 class variable_sensitivity_object_factoryt;
 using variable_sensitivity_object_factory_ptrt =
   std::shared_ptr<variable_sensitivity_object_factoryt>;
@@ -44,7 +48,9 @@ class variable_sensitivity_object_factoryt
   }
 
   explicit variable_sensitivity_object_factoryt(const vsd_configt &options)
-    : configuration{options}, heap_allocations(0)
+    : configuration{options},
+      heap_allocations(0),
+      packing(options.maximum_pack_size)
   {
   }
 
@@ -82,6 +88,36 @@ class variable_sensitivity_object_factoryt
     return configuration;
   }
 
+  /// Look up an object that is equal to \p object in the table of unique
+  /// objects, adding \p object if there is none. Only objects that have value
+  /// equality (see \ref abstract_objectt::has_value_equality) are shared; any
+  /// other object is returned as is.
+  /// \return the unique object equal to \p object
+  abstract_object_pointert intern(const abstract_object_pointert &object);
+
+  /// Record the outcome of merging two abstract objects
+  /// \param shortcut: true if the objects were known to be equal, such that
+  ///   no merge was necessary
+  /// \param allocated: true if the merge produced a new object
+  void record_merge(bool shortcut, bool allocated)
+  {
+    ++merges;
+    if(shortcut)
+      ++merge_shortcuts;
+    if(allocated)
+      ++merge_allocations;
+  }
+
+  /// Add the counts of merges and of shared objects to \p statistics
+  void get_statistics(abstract_object_statisticst &statistics) const;
+
+  /// \return the packs of related variables that all abstract environments of
+  ///   the analysis share, or a null pointer if relations are not tracked
+  zone_packingt *zone_packing()
+  {
+    return configuration.relations == relationst::zones ? &packing : nullptr;
+  }
+
 private:
   /// Decide which abstract object type to use for the variable in question.
   ///
@@ -93,6 +129,19 @@ class variable_sensitivity_object_factoryt
 
   vsd_configt configuration;
   mutable size_t heap_allocations;
+  zone_packingt packing;
+
+  /// Objects with value equality, by their hash. The table does not keep the
+  /// objects alive; expired entries are removed when their bucket is visited.
+  std::unordered_map<
+    std::size_t,
+    std::vector<std::weak_ptr<const abstract_objectt>>>
+    unique_table;
+
+  std::size_t merges = 0;
+  std::size_t merge_shortcuts = 0;
+  std::size_t merge_allocations = 0;
+  std::size_t intern_hits = 0;
 };
 
 #endif // CPROVER_ANALYSES_VARIABLE_SENSITIVITY_VARIABLE_SENSITIVITY_OBJECT_FACTORY_H // NOLINT(*)
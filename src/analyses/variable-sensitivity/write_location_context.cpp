@@ -8,7 +8,10 @@
 
 #include "write_location_context.h"
 
+#include <util/irep_hash.h>
+
 #include <algorithm>
+#include <typeinfo>
 
 context_abstract_objectt::locationst
 write_location_contextt::get_last_written_locations() const
@@ -322,6 +325,40 @@ bool write_location_contextt::has_been_modified(
   return !all_matched;
 }
 
+size_t write_location_contextt::internal_hash() const
+{
+  // The locations are ordered by address, so combine them in a way that does
+  // not depend on that order
+  size_t locations_hash = 0;
+  for(const auto &location : last_written_locations)
+    locations_hash += location->location_number;
+
+  return hash_combine(child_abstract_object->internal_hash(), locations_hash);
+}
+
+bool write_location_contextt::internal_equality(
+  const abstract_object_pointert &other) const
+{
+  auto cast_other =
+    std::dynamic_pointer_cast<const write_location_contextt>(other);
+  if(
+    !cast_other ||
+    last_written_locations != cast_other->last_written_locations)
+  {
+    return false;
+  }
+
+  const abstract_object_pointert &child = child_abstract_object;
+  const abstract_object_pointert &other_child =
+    cast_other->child_abstract_object;
+  return child == other_child ||
+         (typeid(*child) == typeid(*other_child) &&
+          child->is_top() == other_child->is_top() &&
+          child->is_bottom() == other_child->is_bottom() &&
+          child->type() == other_child->type() &&
+          child->internal_equality(other_child));
+}
+
 /**
  * Internal helper function to format and output a given set of locations
  *
@@ -72,6 +72,16 @@ class write_location_contextt : public context_abstract_objectt
   void output(std::ostream &out, const class ai_baset &ai, const namespacet &ns)
     const override;
 
+  size_t internal_hash() const override;
+  bool internal_equality(const abstract_object_pointert &other) const override;
+
+  /// A context compares by value whenever the object it wraps does, as
+  /// the write locations are then the only other state to compare
+  bool has_value_equality() const override
+  {
+    return child_abstract_object->has_value_equality();
+  }
+
 protected:
   CLONE
 
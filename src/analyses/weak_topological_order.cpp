@@ -0,0 +1,333 @@
+/*******************************************************************\
+
+Module: Weak Topological Ordering of Goto Programs
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Weak topological ordering of the instructions of goto programs.
+
+#include "weak_topological_order.h"
+
+#include <util/invariant.h>
+#include <util/optional.h>
+
+#include <goto-programs/goto_functions.h>
+
+#include <algorithm>
+#include <limits>
+#include <ostream>
+
+weak_topological_ordert::weak_topological_ordert(
+  const goto_functionst &goto_functions)
+{
+  for(const auto &gf_entry : goto_functions.function_map)
+  {
+    if(gf_entry.second.body_available())
+      add(gf_entry.second.body);
+  }
+}
+
+/// An element of a partition: either a single instruction or a component, in
+/// which case \c children is the partition of the remainder of the component
+/// in reverse order.
+struct wto_elementt
+{
+  std::size_t node;
+  bool is_component;
+  std::vector<std::size_t> children;
+};
+
+/// A pending call of Bourdoncle's recursive `visit` or `component` procedure.
+struct wto_framet
+{
+  wto_framet(
+    bool is_component,
+    std::size_t node,
+    std::vector<std::size_t> successors,
+    std::size_t partition)
+    : is_component(is_component),
+      node(node),
+      successors(std::move(successors)),
+      partition(partition)
+  {
+  }
+
+  bool is_component;
+  std::size_t node;
+  std::vector<std::size_t> successors;
+  std::size_t next_successor = 0;
+  std::size_t head = 0;
+  bool loop = false;
+  /// Partition to add the result to: 0 for the top-level partition, otherwise
+  /// the children of element `partition - 1`
+  std::size_t partition;
+  /// Element created by a `component` call
+  std::size_t element = 0;
+};
+
+void weak_topological_ordert::add(const goto_programt &goto_program)
+{
+  if(
+    goto_program.instructions.empty() ||
+    contains(goto_program.instructions.begin()))
+  {
+    return;
+  }
+
+  std::vector<locationt> nodes;
+  std::unordered_map<const goto_programt::instructiont *, std::size_t> index;
+  for(auto it = goto_program.instructions.begin();
+      it != goto_program.instructions.end();
+      ++it)
+  {
+    index.emplace(&*it, nodes.size());
+    nodes.push_back(it);
+  }
+
+  const auto successors = [&](std::size_t node) {
+    std::vector<std::size_t> result;
+    for(const auto &successor : goto_program.get_successors(nodes[node]))
+    {
+      if(successor != goto_program.instructions.end())
+        result.push_back(index.at(&*successor));
+    }
+    return result;
+  };
+
+  // This is the algorithm of Bourdoncle's paper with the recursion made
+  // explicit, as goto programs can be too long for the call stack.
+  const std::size_t infinity = std::numeric_limits<std::size_t>::max();
+  std::vector<std::size_t> dfn(nodes.size(), 0);
+  std::size_t num = 0;
+  std::vector<std::size_t> stack;
+
+  std::vector<wto_elementt> elements;
+  std::vector<std::size_t> top_level;
+  const auto partition = [&](std::size_t p) -> std::vector<std::size_t> & {
+    return p == 0 ? top_level : elements[p - 1].children;
+  };
+
+  std::vector<wto_framet> frames;
+  const auto visit = [&](std::size_t node, std::size_t p) {
+    stack.push_back(node);
+    dfn[node] = ++num;
+    frames.emplace_back(false, node, successors(node), p);
+    frames.back().head = dfn[node];
+  };
+
+  // result of the most recently completed call of visit
+  std::size_t result = 0;
+  bool has_result = false;
+
+  visit(0, 0);
+
+  while(!frames.empty())
+  {
+    wto_framet &frame = frames.back();
+
+    if(!frame.is_component)
+    {
+      if(has_result)
+      {
+        if(result <= frame.head)
+        {
+          frame.head = result;
+          frame.loop = true;
+        }
+        has_result = false;
+      }
+
+      bool descended = false;
+      while(frame.next_successor < frame.successors.size())
+      {
+        const std::size_t successor =
+          frame.successors[frame.next_successor++];
+        if(dfn[successor] == 0)
+        {
+          visit(successor, frame.partition);
+          descended = true;
+          break;
+        }
+        else if(dfn[successor] <= frame.head)
+        {
+          frame.head = dfn[successor];
+          frame.loop = true;
+        }
+      }
+
+      if(descended)
+        continue;
+
+      const std::size_t node = frame.node;
+      const std::size_t head = frame.head;
+      const bool loop = frame.loop;
+      const std::size_t p = frame.partition;
+      frames.pop_back();
+
+      if(head == dfn[node])
+      {
+        dfn[node] = infinity;
+        std::size_t element = stack.back();
+        stack.pop_back();
+
+        if(loop)
+        {
+          while(element != node)
+          {
+            dfn[element] = 0;
+            element = stack.back();
+            stack.pop_back();
+          }
+
+          elements.push_back({node, true, {}});
+          frames.emplace_back(true, node, successors(node), p);
+          frames.back().head = head;
+          frames.back().element = elements.size() - 1;
+          continue;
+        }
+
+        elements.push_back({node, false, {}});
+        partition(p).push_back(elements.size() - 1);
+      }
+
+      result = head;
+      has_result = true;
+    }
+    else
+    {
+      // results of visits within a component are not needed
+      has_result = false;
+
+      bool descended = false;
+      while(frame.next_successor < frame.successors.size())
+      {
+        const std::size_t successor =
+          frame.successors[frame.next_successor++];
+        if(dfn[successor] == 0)
+        {
+          visit(successor, frame.element + 1);
+          descended = true;
+          break;
+        }
+      }
+
+      if(descended)
+        continue;
+
+      partition(frame.partition).push_back(frame.element);
+      result = frame.head;
+      has_result = true;
+      frames.pop_back();
+    }
+  }
+
+  INVARIANT(stack.empty(), "all visited nodes are assigned to a partition");
+
+  // Partitions are stored in reverse order, as Bourdoncle's algorithm adds
+  // elements at the front.
+  struct todot
+  {
+    const std::vector<std::size_t> *partition;
+    std::size_t remaining;
+    optionalt<std::size_t> head;
+  };
+  std::vector<todot> todo;
+  todo.push_back({&top_level, top_level.size(), {}});
+
+  while(!todo.empty())
+  {
+    todot &current = todo.back();
+
+    if(current.remaining == 0)
+    {
+      if(current.head.has_value())
+        entries[&*nodes[*current.head]].component_end = order.size();
+      todo.pop_back();
+      continue;
+    }
+
+    const wto_elementt &element =
+      elements[(*current.partition)[--current.remaining]];
+
+    entryt &entry = entries[&*nodes[element.node]];
+    entry.position = order.size();
+    entry.depth = todo.size() - 1 + (element.is_component ? 1 : 0);
+    order.push_back(nodes[element.node]);
+
+    if(element.is_component)
+    {
+      todo.push_back(
+        {&element.children, element.children.size(), element.node});
+    }
+  }
+
+  // instructions that are not reachable from the entry come last
+  for(std::size_t node = 0; node < nodes.size(); ++node)
+  {
+    if(dfn[node] == 0)
+    {
+      entryt &entry = entries[&*nodes[node]];
+      entry.position = order.size();
+      order.push_back(nodes[node]);
+    }
+  }
+}
+
+const weak_topological_ordert::entryt &
+weak_topological_ordert::entry(locationt location) const
+{
+  const auto entry_it = entries.find(&*location);
+  PRECONDITION(entry_it != entries.end());
+  return entry_it->second;
+}
+
+void weak_topological_ordert::output(
+  const goto_programt &goto_program,
+  std::ostream &out) const
+{
+  std::vector<locationt> locations;
+  for(auto it = goto_program.instructions.begin();
+      it != goto_program.instructions.end();
+      ++it)
+  {
+    if(contains(it))
+      locations.push_back(it);
+  }
+  std::sort(
+    locations.begin(),
+    locations.end(),
+    [this](const locationt &a, const locationt &b) {
+      return position(a) < position(b);
+    });
+
+  std::vector<std::size_t> component_ends;
+  bool first = true;
+  for(const auto &location : locations)
+  {
+    const entryt &e = entry(location);
+
+    while(!component_ends.empty() && component_ends.back() <= e.position)
+    {
+      out << ')';
+      component_ends.pop_back();
+    }
+
+    if(!first)
+      out << ' ';
+    first = false;
+
+    if(e.component_end != 0)
+    {
+      out << '(';
+      component_ends.push_back(e.component_end);
+    }
+
+    out << location->location_number;
+  }
+
+  for(std::size_t i = 0; i < component_ends.size(); ++i)
+    out << ')';
+}
@@ -0,0 +1,107 @@
+/*******************************************************************\
+
+Module: Weak Topological Ordering of Goto Programs
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Weak topological ordering of the instructions of goto programs.
+///
+/// A weak topological ordering (WTO), as defined by Bourdoncle in "Efficient
+/// chaotic iteration strategies with widenings" (FMPA 1993), is a
+/// hierarchical decomposition of a control-flow graph into nested strongly
+/// connected components, each of which has a single head. Writing components
+/// in parentheses with the head first, the loop
+///
+///     1: x = 0
+///     2: IF x >= 10 GOTO 5
+///     3: x = x + 1
+///     4: GOTO 2
+///     5: END_FUNCTION
+///
+/// has the WTO `1 (2 3 4) 5`. Iterating in this order, and stabilising each
+/// component before leaving it, is a good strategy for abstract
+/// interpretation. Widening is only required at the heads of components as
+/// every cycle of the control-flow graph goes through at least one of them.
+
+#ifndef CPROVER_ANALYSES_WEAK_TOPOLOGICAL_ORDER_H
+#define CPROVER_ANALYSES_WEAK_TOPOLOGICAL_ORDER_H
+
+#include <goto-programs/goto_program.h>
+
+#include <iosfwd>
+#include <unordered_map>
+#include <vector>
+
+class goto_functionst;
+
+/// Weak topological ordering of the instructions of one or more goto
+/// programs. Each instruction is assigned a position that is unique across all
+/// programs that have been added.
+class weak_topological_ordert
+{
+public:
+  typedef goto_programt::const_targett locationt;
+
+  weak_topological_ordert() = default;
+
+  /// Compute the ordering of the instructions of all functions with a body
+  explicit weak_topological_ordert(const goto_functionst &goto_functions);
+
+  /// Compute the ordering of the instructions of \p goto_program, unless that
+  /// has been done before. Instructions that are not reachable from the first
+  /// instruction come after all reachable ones, in program order.
+  void add(const goto_programt &goto_program);
+
+  /// \return true if the ordering of \p location has been computed
+  bool contains(locationt location) const
+  {
+    return entries.find(&*location) != entries.end();
+  }
+
+  /// \return the position of \p location in the ordering
+  std::size_t position(locationt location) const
+  {
+    return entry(location).position;
+  }
+
+  /// \return true if \p location is the head of a component
+  bool is_head(locationt location) const
+  {
+    return entry(location).component_end != 0;
+  }
+
+  /// \return the number of components that contain \p location, counting the
+  ///   component a head belongs to
+  std::size_t depth(locationt location) const
+  {
+    return entry(location).depth;
+  }
+
+  /// Output the ordering of \p goto_program using location numbers, with
+  /// components in parentheses, for example `1 (2 3 4) 5`
+  void output(const goto_programt &goto_program, std::ostream &out) const;
+
+protected:
+  struct entryt
+  {
+    std::size_t position = 0;
+
+    /// For heads, the position following the last element of the component;
+    /// zero for all other instructions
+    std::size_t component_end = 0;
+
+    std::size_t depth = 0;
+  };
+
+  std::unordered_map<const goto_programt::instructiont *, entryt> entries;
+
+  /// The instructions of all programs in the order of their positions
+  std::vector<locationt> order;
+
+  const entryt &entry(locationt location) const;
+};
+
+#endif // CPROVER_ANALYSES_WEAK_TOPOLOGICAL_ORDER_H
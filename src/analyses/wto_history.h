@@ -0,0 +1,79 @@
+/*******************************************************************\
+
+Module: History that Widens at Heads of Weak Topological Ordering Components
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// A history that does not distinguish traces but suggests widening at the
+/// heads of the components of a weak topological ordering.
+
+#ifndef CPROVER_ANALYSES_WTO_HISTORY_H
+#define CPROVER_ANALYSES_WTO_HISTORY_H
+
+#include "ai_history.h"
+#include "weak_topological_order.h"
+
+/// Like \ref ahistoricalt, this only records the current location. Merges into
+/// the head of a component of the weak topological ordering are widened. As
+/// every cycle of the control-flow graph goes through a head, this suffices
+/// for termination while keeping the precision of the other merges.
+class wto_historyt : public ahistoricalt
+{
+protected:
+  std::shared_ptr<const weak_topological_ordert> order;
+
+public:
+  wto_historyt(
+    locationt l,
+    std::shared_ptr<const weak_topological_ordert> order)
+    : ahistoricalt(l), order(std::move(order))
+  {
+  }
+
+  step_returnt step(
+    locationt to,
+    const trace_sett &others,
+    trace_ptrt caller_hist) const override
+  {
+    if(others.empty())
+      return std::make_pair(
+        step_statust::NEW, std::make_shared<wto_historyt>(to, order));
+
+    INVARIANT(others.size() == 1, "Only needs one history per location");
+    return std::make_pair(step_statust::MERGED, *others.begin());
+  }
+
+  bool should_widen(const ai_history_baset &other) const override
+  {
+    const locationt &l = other.current_location();
+    return order->contains(l) && order->is_head(l);
+  }
+
+  void output(std::ostream &out) const override
+  {
+    out << "wto : location " << current_location()->location_number;
+  }
+};
+
+class wto_history_factoryt : public ai_history_factory_baset
+{
+protected:
+  std::shared_ptr<const weak_topological_ordert> order;
+
+public:
+  explicit wto_history_factoryt(
+    std::shared_ptr<const weak_topological_ordert> order)
+    : order(std::move(order))
+  {
+  }
+
+  ai_history_baset::trace_ptrt epoch(ai_history_baset::locationt l) override
+  {
+    return std::make_shared<wto_historyt>(l, order);
+  }
+};
+
+#endif // CPROVER_ANALYSES_WTO_HISTORY_H
@@ -11,6 +11,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <fstream>
 
 #include <util/config.h>
+#include <util/file_util.h>
 #include <util/get_base_name.h>
 
 #include <linking/linking.h>
@@ -47,6 +48,18 @@ bool ansi_c_languaget::preprocess(
   return c_preprocess(path, outstream, get_message_handler());
 }
 
+/// Set up the parser for C with the current configuration
+static void init_ansi_c_parser(message_handlert &message_handler)
+{
+  ansi_c_parser.clear();
+  ansi_c_parser.set_message_handler(message_handler);
+  ansi_c_parser.for_has_scope=config.ansi_c.for_has_scope;
+  ansi_c_parser.ts_18661_3_Floatn_types=config.ansi_c.ts_18661_3_Floatn_types;
+  ansi_c_parser.cpp98=false; // it's not C++
+  ansi_c_parser.cpp11=false; // it's not C++
+  ansi_c_parser.mode=config.ansi_c.mode;
+}
+
 bool ansi_c_languaget::parse(
   std::istream &instream,
   const std::string &path)
@@ -54,29 +67,39 @@ bool ansi_c_languaget::parse(
   // store the path
   parse_path=path;
 
+  precompiled_header.reset();
+  precompiled_header_file_name.clear();
+  header_parse_tree.clear();
+
   // preprocessing
   std::ostringstream o_preprocessed;
 
   if(preprocess(instream, path, o_preprocessed))
     return true;
 
-  std::istringstream i_preprocessed(o_preprocessed.str());
-
   // parsing
 
   std::string code;
   ansi_c_internal_additions(code);
+
+  if(!config.ansi_c.precompiled_headers.empty())
+  {
+    const auto split = split_precompiled_header(o_preprocessed.str());
+    if(split.has_value())
+    {
+      const auto result =
+        parse_with_precompiled_header(code, split->first, split->second);
+      if(result.has_value())
+        return *result;
+    }
+  }
+
+  std::istringstream i_preprocessed(o_preprocessed.str());
   std::istringstream codestr(code);
 
-  ansi_c_parser.clear();
+  init_ansi_c_parser(get_message_handler());
   ansi_c_parser.set_file(ID_built_in);
   ansi_c_parser.in=&codestr;
-  ansi_c_parser.set_message_handler(get_message_handler());
-  ansi_c_parser.for_has_scope=config.ansi_c.for_has_scope;
-  ansi_c_parser.ts_18661_3_Floatn_types=config.ansi_c.ts_18661_3_Floatn_types;
-  ansi_c_parser.cpp98=false; // it's not C++
-  ansi_c_parser.cpp11=false; // it's not C++
-  ansi_c_parser.mode=config.ansi_c.mode;
 
   ansi_c_scanner_init();
 
@@ -100,6 +123,83 @@ bool ansi_c_languaget::parse(
   return result;
 }
 
+optionalt<bool> ansi_c_languaget::parse_with_precompiled_header(
+  const std::string &built_in,
+  const std::string &headers,
+  const std::string &rest)
+{
+  precompiled_headert header;
+  header.key = precompiled_header_key(built_in, headers);
+  const std::string file_name =
+    precompiled_header_file(config.ansi_c.precompiled_headers, header.key);
+
+  if(file_exists(file_name) && !header.read(file_name))
+  {
+    statistics() << "Reading precompiled header " << file_name << eom;
+
+    init_ansi_c_parser(get_message_handler());
+    ansi_c_parser.root_scope().name_map.swap(header.names);
+  }
+  else
+  {
+    // Headers that do not parse on their own, e.g. because a declaration
+    // continues in the main file, or that give warnings, which a
+    // precompiled header would not repeat, are parsed with the main file.
+    null_message_handlert null_message_handler;
+    init_ansi_c_parser(null_message_handler);
+
+    std::istringstream codestr(built_in);
+    ansi_c_parser.set_file(ID_built_in);
+    ansi_c_parser.in=&codestr;
+    ansi_c_scanner_init();
+    bool result=ansi_c_parser.parse();
+
+    if(!result)
+    {
+      std::istringstream headers_in(headers);
+      ansi_c_parser.set_line_no(0);
+      ansi_c_parser.set_file(parse_path);
+      ansi_c_parser.in=&headers_in;
+      ansi_c_scanner_init();
+      result=ansi_c_parser.parse();
+    }
+
+    if(
+      result ||
+      null_message_handler.get_message_count(messaget::M_WARNING) != 0 ||
+      ansi_c_parser.scopes.size() != 1 ||
+      ansi_c_parser.root_scope().compound_counter != 0 ||
+      !ansi_c_parser.pragma_pack.empty() ||
+      !ansi_c_parser.pragma_cprover_empty())
+    {
+      ansi_c_parser.clear();
+      return {};
+    }
+
+    header_parse_tree.swap(ansi_c_parser.parse_tree);
+    header.names = ansi_c_parser.root_scope().name_map;
+    precompiled_header_file_name = file_name;
+    ansi_c_parser.set_message_handler(get_message_handler());
+  }
+
+  precompiled_header = std::move(header);
+
+  std::istringstream rest_in(rest);
+  ansi_c_parser.set_line_no(0);
+  ansi_c_parser.set_file(parse_path);
+  ansi_c_parser.in=&rest_in;
+  ansi_c_scanner_init();
+  const bool result=ansi_c_parser.parse();
+
+  // save result
+  parse_tree.swap(ansi_c_parser.parse_tree);
+
+  // save some memory
+  ansi_c_parser.clear();
+
+  return result;
+}
+
 bool ansi_c_languaget::typecheck(
   symbol_tablet &symbol_table,
   const std::string &module,
@@ -115,11 +215,58 @@ bool ansi_c_languaget::typecheck(
   const std::set<irep_idt> &keep)
 {
   symbol_tablet new_symbol_table;
+  std::unordered_map<irep_idt, irep_idt> asm_labels;
+
+  if(precompiled_header.has_value())
+  {
+    if(precompiled_header_file_name.empty())
+    {
+      // the headers were typechecked as part of another translation unit
+      for(auto it = precompiled_header->symbol_table.begin();
+          it != precompiled_header->symbol_table.end();
+          ++it)
+      {
+        it.get_writeable_symbol().module = module;
+      }
+    }
+    else
+    {
+      const unsigned warnings_before =
+        get_message_handler().get_message_count(messaget::M_WARNING);
+
+      if(ansi_c_typecheck(
+           header_parse_tree,
+           precompiled_header->symbol_table,
+           module,
+           precompiled_header->asm_labels,
+           get_message_handler()))
+      {
+        return true;
+      }
+
+      // As with parsing, headers that give warnings are not stored. Storing
+      // is best effort.
+      const std::string &directory = config.ansi_c.precompiled_headers;
+      if(
+        get_message_handler().get_message_count(messaget::M_WARNING) ==
+          warnings_before &&
+        (is_directory(directory) || create_directory(directory)))
+      {
+        precompiled_header->write(precompiled_header_file_name);
+      }
+    }
+
+    new_symbol_table.swap(precompiled_header->symbol_table);
+    asm_labels.swap(precompiled_header->asm_labels);
+    precompiled_header.reset();
+    header_parse_tree.clear();
+  }
 
   if(ansi_c_typecheck(
     parse_tree,
     new_symbol_table,
     module,
+    asm_labels,
     get_message_handler()))
   {
     return true;
@@ -144,6 +291,7 @@ bool ansi_c_languaget::generate_support_functions(
 
 void ansi_c_languaget::show_parse(std::ostream &out)
 {
+  header_parse_tree.output(out);
   parse_tree.output(out);
 }
 
@@ -18,6 +18,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "ansi_c_parse_tree.h"
 #include "c_object_factory_parameters.h"
+#include "precompiled_header.h"
 
 // clang-format off
 #define OPT_ANSI_C_LANGUAGE \
@@ -112,6 +113,29 @@ class ansi_c_languaget:public languaget
   ansi_c_parse_treet parse_tree;
   std::string parse_path;
 
+  /// The precompiled header that the translation unit continues from, see
+  /// \ref precompiled_headert
+  optionalt<precompiled_headert> precompiled_header;
+
+  /// The file in which the precompiled header is to be stored once it has
+  /// been typechecked, or empty if it has been read
+  std::string precompiled_header_file_name;
+
+  /// The declarations of the headers of a precompiled header that is to be
+  /// stored
+  ansi_c_parse_treet header_parse_tree;
+
+  /// Parse the rest of the translation unit, after \p built_in and
+  /// \p headers, continuing from their precompiled header, which is first
+  /// created if there is none
+  /// \return the result of parsing, or an empty optional if the headers
+  ///   cannot be precompiled and the translation unit is to be parsed as a
+  ///   whole
+  optionalt<bool> parse_with_precompiled_header(
+    const std::string &built_in,
+    const std::string &headers,
+    const std::string &rest);
+
   c_object_factory_parameterst object_factory_params;
 };
 
@@ -32,6 +32,21 @@ bool ansi_c_typecheck(
   return ansi_c_typecheck.typecheck_main();
 }
 
+bool ansi_c_typecheck(
+  ansi_c_parse_treet &ansi_c_parse_tree,
+  symbol_tablet &symbol_table,
+  const std::string &module,
+  std::unordered_map<irep_idt, irep_idt> &asm_labels,
+  message_handlert &message_handler)
+{
+  ansi_c_typecheckt ansi_c_typecheck(
+    ansi_c_parse_tree, symbol_table, module, message_handler);
+  ansi_c_typecheck.asm_labels().swap(asm_labels);
+  const bool result = ansi_c_typecheck.typecheck_main();
+  ansi_c_typecheck.asm_labels().swap(asm_labels);
+  return result;
+}
+
 bool ansi_c_typecheck(
   exprt &expr,
   message_handlert &message_handler,
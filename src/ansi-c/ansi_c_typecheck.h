@@ -22,6 +22,22 @@ bool ansi_c_typecheck(
   const std::string &module,
   message_handlert &message_handler);
 
+/// Typecheck the declarations of \p parse_tree, which continue a translation
+/// unit whose earlier declarations are already in \p symbol_table
+/// \param parse_tree: the declarations to typecheck
+/// \param symbol_table: the symbols of the translation unit
+/// \param module: the name of the translation unit
+/// \param [in,out] asm_labels: the asm labels of the earlier declarations,
+///   to which those of \p parse_tree are added
+/// \param message_handler: the message handler
+/// \return true on error, false otherwise
+bool ansi_c_typecheck(
+  ansi_c_parse_treet &parse_tree,
+  symbol_tablet &symbol_table,
+  const std::string &module,
+  std::unordered_map<irep_idt, irep_idt> &asm_labels,
+  message_handlert &message_handler);
+
 bool ansi_c_typecheck(
   exprt &expr,
   message_handlert &message_handler,
@@ -56,6 +72,11 @@ class ansi_c_typecheckt:public c_typecheck_baset
 
   virtual void typecheck();
 
+  asm_label_mapt &asm_labels()
+  {
+    return asm_label_map;
+  }
+
 protected:
   ansi_c_parse_treet &parse_tree;
 };
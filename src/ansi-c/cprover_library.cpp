@@ -14,11 +14,11 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/symbol_table.h>
 
 #include "ansi_c_language.h"
+#include "library_cache.h"
 
-static std::string get_cprover_library_text(
-  const std::set<irep_idt> &functions,
-  const symbol_tablet &symbol_table,
-  const bool force_load)
+/// \return the text that precedes the models of the library, which depends
+///   on the configuration
+static std::string get_cprover_library_prologue()
 {
   std::ostringstream library_text;
 
@@ -44,16 +44,28 @@ static std::string get_cprover_library_text(
   if(config.ansi_c.string_abstraction)
     library_text << "#define " CPROVER_PREFIX "STRING_ABSTRACTION\n";
 
-  // cprover_library.inc may not have been generated when running Doxygen, thus
-  // make Doxygen skip this part
-  /// \cond
-  const struct cprover_library_entryt cprover_library[] =
+  return library_text.str();
+}
+
+// cprover_library.inc may not have been generated when running Doxygen, thus
+// make Doxygen skip this part
+/// \cond
+static const struct cprover_library_entryt cprover_library[] =
 #include "cprover_library.inc"
-    ; // NOLINT(whitespace/semicolon)
-  /// \endcond
+  ; // NOLINT(whitespace/semicolon)
+/// \endcond
 
+static std::string get_cprover_library_text(
+  const std::set<irep_idt> &functions,
+  const symbol_tablet &symbol_table,
+  const bool force_load)
+{
   return get_cprover_library_text(
-    functions, symbol_table, cprover_library, library_text.str(), force_load);
+    functions,
+    symbol_table,
+    cprover_library,
+    get_cprover_library_prologue(),
+    force_load);
 }
 
 std::string get_cprover_library_text(
@@ -103,6 +115,38 @@ void cprover_c_library_factory(
   if(config.ansi_c.lib==configt::ansi_ct::libt::LIB_NONE)
     return;
 
+  if(!config.ansi_c.library_cache.empty())
+  {
+    const library_cachet library_cache(
+      config.ansi_c.library_cache,
+      get_cprover_library_prologue(),
+      message_handler);
+
+    // the functions that are not added from the cache are typechecked below
+    std::set<irep_idt> uncached_functions;
+
+    for(const cprover_library_entryt *e = cprover_library;
+        e->function != nullptr;
+        e++)
+    {
+      const irep_idt id = e->function;
+      const symbolt *symbol = symbol_table.lookup(id);
+      if(
+        functions.count(id) != 0 && symbol != nullptr &&
+        symbol->value.is_nil() &&
+        !library_cache.add(id, e->model, symbol_table))
+      {
+        uncached_functions.insert(id);
+      }
+    }
+
+    std::string library_text =
+      get_cprover_library_text(uncached_functions, symbol_table, false);
+
+    add_library(library_text, symbol_table, message_handler);
+    return;
+  }
+
   std::string library_text =
     get_cprover_library_text(functions, symbol_table, false);
 
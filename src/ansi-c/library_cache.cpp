@@ -0,0 +1,213 @@
+/*******************************************************************\
+
+Module: Cache of the Typechecked CPROVER Library
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Cache of the typechecked models of the CPROVER library
+
+#include "library_cache.h"
+
+#include <util/cache_key.h>
+#include <util/config.h>
+#include <util/file_util.h>
+#include <util/find_symbols.h>
+#include <util/message.h>
+#include <util/std_types.h>
+#include <util/string_hash.h>
+#include <util/symbol_table.h>
+#include <util/version.h>
+
+#include <goto-programs/goto_model.h>
+#include <goto-programs/read_bin_goto_object.h>
+#include <goto-programs/write_goto_binary.h>
+
+#include "ansi_c_language.h"
+
+#include <fstream>
+#include <random>
+#include <sstream>
+
+library_cachet::library_cachet(
+  std::string directory,
+  std::string prologue,
+  message_handlert &message_handler)
+  : directory(std::move(directory)),
+    prologue(std::move(prologue)),
+    log(message_handler)
+{
+}
+
+optionalt<symbol_tablet> library_cachet::get(
+  const irep_idt &function,
+  const std::string &model) const
+{
+  const std::string key =
+    std::string{CBMC_VERSION} + '\n' + config.ansi_c.typecheck_settings() +
+    prologue + id2string(function) + '\n' + model;
+  const std::string file_name = concat_dir_file(
+    directory, "library-" + std::to_string(hash_string(key)) + ".gb");
+
+  // the messages of a failure are repeated when the caller falls back to
+  // typechecking the model with the program
+  null_message_handlert null_message_handler;
+
+  // a model without the function, e.g. because the function is only
+  // defined for other operating systems, is kept as well
+  if(file_exists(file_name))
+  {
+    std::ifstream in(file_name, std::ios::binary);
+    symbol_tablet cached_symbol_table;
+    goto_functionst no_functions;
+    if(
+      in && !read_cache_key(in, key) &&
+      !read_bin_goto_object(
+        in, file_name, cached_symbol_table, no_functions, null_message_handler))
+    {
+      log.statistics() << "Reading the model of " << function
+                       << " from the library cache" << messaget::eom;
+      if(!cached_symbol_table.has_symbol(function))
+        return {};
+      return std::move(cached_symbol_table);
+    }
+  }
+
+  std::istringstream in(prologue + model + '\n');
+  ansi_c_languaget ansi_c_language;
+  ansi_c_language.set_message_handler(null_message_handler);
+  if(ansi_c_language.parse(in, ""))
+    return {};
+
+  goto_modelt library;
+  if(ansi_c_language.typecheck(
+       library.symbol_table, "<built-in-library>", true, {function}))
+  {
+    return {};
+  }
+
+  // storing is best effort, and another run may be storing the same file
+  if(is_directory(directory) || create_directory(directory))
+  {
+    const std::string temporary_file_name =
+      file_name + "." + std::to_string(std::random_device{}());
+
+    bool error;
+    {
+      std::ofstream out(temporary_file_name, std::ios::binary);
+      write_cache_key(out, key);
+      error = !out || write_goto_binary(out, library);
+    }
+
+    try
+    {
+      if(error)
+        file_remove(temporary_file_name);
+      else
+        file_rename(temporary_file_name, file_name);
+    }
+    catch(const system_exceptiont &)
+    {
+      file_remove(temporary_file_name);
+    }
+  }
+
+  if(!library.symbol_table.has_symbol(function))
+    return {};
+
+  return std::move(library.symbol_table);
+}
+
+/// \return true if \p a and \p b are the same type, where functions only need
+///   to agree on the types of their parameters and not on their names
+static bool same_type(const typet &a, const typet &b)
+{
+  if(a.id() != ID_code || b.id() != ID_code)
+    return a == b;
+
+  const code_typet &code_a = to_code_type(a);
+  const code_typet &code_b = to_code_type(b);
+
+  if(
+    code_a.return_type() != code_b.return_type() ||
+    code_a.has_ellipsis() != code_b.has_ellipsis() ||
+    code_a.parameters().size() != code_b.parameters().size())
+  {
+    return false;
+  }
+
+  for(std::size_t i = 0; i < code_a.parameters().size(); ++i)
+  {
+    if(code_a.parameters()[i].type() != code_b.parameters()[i].type())
+      return false;
+  }
+
+  return true;
+}
+
+bool library_cachet::add(
+  const irep_idt &function,
+  const std::string &model,
+  symbol_tablet &symbol_table) const
+{
+  const auto library = get(function, model);
+  if(!library.has_value())
+    return false;
+
+  // the symbols that the model uses
+  find_symbols_sett used;
+  std::vector<irep_idt> pending{function};
+  while(!pending.empty())
+  {
+    const irep_idt identifier = pending.back();
+    pending.pop_back();
+
+    const symbolt *symbol = library->lookup(identifier);
+    if(symbol == nullptr || !used.insert(identifier).second)
+      continue;
+
+    find_symbols_sett found;
+    find_type_and_expr_symbols(symbol->type, found);
+    find_type_and_expr_symbols(symbol->value, found);
+    pending.insert(pending.end(), found.begin(), found.end());
+  }
+
+  // the program must declare the symbols that it shares with the model in
+  // the same way, and must not define the function yet
+  for(const irep_idt &identifier : used)
+  {
+    const symbolt *existing = symbol_table.lookup(identifier);
+    if(existing == nullptr)
+      continue;
+
+    const symbolt &symbol = library->lookup_ref(identifier);
+    if(
+      existing->is_type != symbol.is_type ||
+      !same_type(existing->type, symbol.type) ||
+      (identifier == function && existing->value.is_not_nil()))
+    {
+      return false;
+    }
+  }
+
+  for(const irep_idt &identifier : used)
+  {
+    const symbolt &symbol = library->lookup_ref(identifier);
+    symbolt *existing = symbol_table.get_writeable(identifier);
+
+    if(existing == nullptr)
+      symbol_table.insert(symbol);
+    else if(
+      existing->type.id() == ID_code && existing->value.is_nil() &&
+      symbol.value.is_not_nil())
+    {
+      // a definition replaces the declaration, including the names of the
+      // parameters
+      *existing = symbol;
+    }
+  }
+
+  return true;
+}
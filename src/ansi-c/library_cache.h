@@ -0,0 +1,70 @@
+/*******************************************************************\
+
+Module: Cache of the Typechecked CPROVER Library
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Cache of the typechecked models of the CPROVER library
+
+#ifndef CPROVER_ANSI_C_LIBRARY_CACHE_H
+#define CPROVER_ANSI_C_LIBRARY_CACHE_H
+
+#include <util/irep.h>
+#include <util/message.h>
+#include <util/optional.h>
+
+#include <string>
+
+class symbol_tablet;
+
+/// Keeps the typechecked model of each library function in a directory, such
+/// that later runs with the same configuration add the model to their symbol
+/// table by merging symbol tables rather than by parsing and typechecking it.
+///
+/// A model is typechecked on its own, i.e., without the declarations of the
+/// program that uses it. Where these declarations conflict with the model,
+/// e.g. because the program declares the function with another signature,
+/// the model is not added from the cache, and the caller falls back to
+/// typechecking it together with the program.
+///
+/// Files are named by a hash of the model, the library prologue, the
+/// configuration that affects typechecking, and the version of this tool,
+/// which together form the key of the file. Each file keeps its key, such
+/// that a file whose name collides with that of another key is not used. A
+/// file is written under a unique name and then renamed, such that parallel
+/// runs can share a directory.
+class library_cachet
+{
+public:
+  /// \param directory: where the models are kept, which is created if it does
+  ///   not exist
+  /// \param prologue: the text that precedes every model
+  /// \param message_handler: message handler
+  library_cachet(
+    std::string directory,
+    std::string prologue,
+    message_handlert &message_handler);
+
+  /// Add the model of \p function, of which \p model is the source text,
+  /// and the symbols that it uses to \p symbol_table
+  /// \return false if the model does not typecheck on its own or conflicts
+  ///   with \p symbol_table, in which case \p symbol_table is unchanged
+  bool add(
+    const irep_idt &function,
+    const std::string &model,
+    symbol_tablet &symbol_table) const;
+
+private:
+  const std::string directory;
+  const std::string prologue;
+  messaget log;
+
+  /// Read the typechecked model from the cache, or typecheck it and store it
+  optionalt<symbol_tablet>
+  get(const irep_idt &function, const std::string &model) const;
+};
+
+#endif // CPROVER_ANSI_C_LIBRARY_CACHE_H
@@ -0,0 +1,285 @@
+/*******************************************************************\
+
+Module: Precompiled Headers
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Snapshots of the C front end after the headers that a translation unit
+/// starts with
+
+#include "precompiled_header.h"
+
+#include <util/cache_key.h>
+#include <util/config.h>
+#include <util/exception_utils.h>
+#include <util/file_util.h>
+#include <util/irep_serialization.h>
+#include <util/message.h>
+#include <util/string_hash.h>
+#include <util/version.h>
+
+#include <goto-programs/goto_functions.h>
+#include <goto-programs/read_bin_goto_object.h>
+#include <goto-programs/write_goto_binary.h>
+
+#include <cctype>
+#include <fstream>
+#include <random>
+
+// A precompiled header is marked with 0x7f PCH, which is followed by its key,
+// the state of the parser and the typechecker as an irep, and then by the
+// symbol table as a goto binary without functions.
+
+bool precompiled_headert::read(const std::string &file_name)
+{
+  std::ifstream in(file_name, std::ios::binary);
+
+  char header[4];
+  in.read(header, sizeof(header));
+  if(
+    !in || header[0] != 0x7f || header[1] != 'P' || header[2] != 'C' ||
+    header[3] != 'H')
+  {
+    return true;
+  }
+
+  if(read_cache_key(in, key))
+    return true;
+
+  names.clear();
+  asm_labels.clear();
+  symbol_table.clear();
+
+  null_message_handlert null_message_handler;
+  goto_functionst goto_functions;
+
+  try
+  {
+    irep_serializationt::ireps_containert ireps_container;
+    irep_serializationt irep_serialization(ireps_container);
+    const irept state = irep_serialization.reference_convert(in);
+
+    for(const auto &entry : state.find("names").get_sub())
+    {
+      ansi_c_identifiert &identifier = names[entry.get(ID_name)];
+      identifier.id_class =
+        static_cast<ansi_c_id_classt>(entry.get_int(ID_class));
+      identifier.base_name = entry.get(ID_base_name);
+      identifier.prefixed_name = entry.get(ID_identifier);
+    }
+
+    for(const auto &entry : state.find("asm_labels").get_sub())
+      asm_labels.emplace(entry.get(ID_identifier), entry.get(ID_label));
+
+    if(!read_bin_goto_object(
+         in, file_name, symbol_table, goto_functions, null_message_handler))
+    {
+      return false;
+    }
+  }
+  catch(const deserialization_exceptiont &)
+  {
+  }
+
+  // do not leave a partial state behind
+  names.clear();
+  asm_labels.clear();
+  symbol_table.clear();
+
+  return true;
+}
+
+bool precompiled_headert::write(const std::string &file_name) const
+{
+  irept state;
+
+  irept &scope = state.add("names");
+  for(const auto &name : names)
+  {
+    irept entry;
+    entry.set(ID_name, name.first);
+    entry.set(ID_class, static_cast<int>(name.second.id_class));
+    entry.set(ID_base_name, name.second.base_name);
+    entry.set(ID_identifier, name.second.prefixed_name);
+    scope.get_sub().push_back(std::move(entry));
+  }
+
+  irept &labels = state.add("asm_labels");
+  for(const auto &asm_label : asm_labels)
+  {
+    irept entry;
+    entry.set(ID_identifier, asm_label.first);
+    entry.set(ID_label, asm_label.second);
+    labels.get_sub().push_back(std::move(entry));
+  }
+
+  // another run may be writing the same file
+  const std::string temporary_file_name =
+    file_name + "." + std::to_string(std::random_device{}());
+
+  {
+    std::ofstream out(temporary_file_name, std::ios::binary);
+    out << char(0x7f) << "PCH";
+    write_cache_key(out, key);
+
+    irep_serializationt::ireps_containert ireps_container;
+    irep_serializationt irep_serialization(ireps_container);
+    irep_serialization.reference_convert(state, out);
+
+    if(!out || write_goto_binary(out, symbol_table, goto_functionst{}))
+    {
+      out.close();
+      file_remove(temporary_file_name);
+      return true;
+    }
+  }
+
+  try
+  {
+    file_rename(temporary_file_name, file_name);
+  }
+  catch(const system_exceptiont &)
+  {
+    file_remove(temporary_file_name);
+    return true;
+  }
+
+  return false;
+}
+
+/// \return the name of the file of the line marker \p line, such as
+///   `# 1 "main.c"` or `#line 1 "main.c"`, or an empty optional if \p line
+///   is not a line marker
+static optionalt<std::string> line_marker_file(const std::string &line)
+{
+  std::size_t i = 0;
+  const auto skip_blanks = [&line, &i]() {
+    while(i < line.size() && (line[i] == ' ' || line[i] == '\t'))
+      ++i;
+  };
+
+  skip_blanks();
+  if(i == line.size() || line[i] != '#')
+    return {};
+  ++i;
+  skip_blanks();
+
+  if(line.compare(i, 4, "line") == 0)
+  {
+    i += 4;
+    skip_blanks();
+  }
+
+  if(i == line.size() || !isdigit(line[i]))
+    return {};
+  while(i < line.size() && isdigit(line[i]))
+    ++i;
+  skip_blanks();
+
+  if(i == line.size() || line[i] != '"')
+    return {};
+
+  const std::size_t begin = ++i;
+  while(i < line.size() && line[i] != '"')
+  {
+    if(line[i] == '\\')
+      ++i;
+    ++i;
+  }
+
+  if(i >= line.size())
+    return {};
+
+  return line.substr(begin, i - begin);
+}
+
+static bool is_blank(const std::string &line)
+{
+  for(const char c : line)
+  {
+    if(!isspace(c))
+      return false;
+  }
+
+  return true;
+}
+
+optionalt<std::pair<std::string, std::string>>
+split_precompiled_header(const std::string &preprocessed)
+{
+  std::string headers;
+  bool has_declarations = false;
+
+  optionalt<std::string> main_file;
+  std::string current_file;
+  std::size_t main_line = 1;
+
+  std::size_t begin = 0;
+  while(begin < preprocessed.size())
+  {
+    std::size_t end = preprocessed.find('\n', begin);
+    end = end == std::string::npos ? preprocessed.size() : end + 1;
+    const std::string line = preprocessed.substr(begin, end - begin);
+
+    const auto file = line_marker_file(line);
+    if(file.has_value())
+    {
+      // the first line marker gives the main file
+      if(!main_file.has_value())
+        main_file = *file;
+
+      current_file = *file;
+      if(current_file == *main_file)
+      {
+        // the line marker applies to the next line
+        main_line =
+          std::stoul(line.substr(line.find_first_of("0123456789")));
+      }
+      else
+        headers += line;
+    }
+    else if(!main_file.has_value() || current_file == *main_file)
+    {
+      if(!is_blank(line))
+        break;
+      ++main_line;
+    }
+    else
+    {
+      headers += line;
+      has_declarations |= !is_blank(line);
+    }
+
+    begin = end;
+  }
+
+  if(!has_declarations)
+    return {};
+
+  std::string rest = "# " + std::to_string(main_line) + " \"" + *main_file +
+                     "\"\n" + preprocessed.substr(begin);
+
+  return std::make_pair(std::move(headers), std::move(rest));
+}
+
+std::string
+precompiled_header_key(const std::string &built_in, const std::string &headers)
+{
+  // source locations include the working directory
+  return std::string{CBMC_VERSION} + '\n' +
+         config.ansi_c.typecheck_settings() +
+         get_current_working_directory() + '\n' + built_in + '\n' + headers;
+}
+
+std::string precompiled_header_file(
+  const std::string &directory,
+  const std::string &key)
+{
+  return concat_dir_file(
+    directory,
+    "header-" + std::to_string(hash_string(key)) + '-' +
+      std::to_string(key.size()) + ".pch");
+}
@@ -0,0 +1,84 @@
+/*******************************************************************\
+
+Module: Precompiled Headers
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Snapshots of the C front end after the headers that a translation unit
+/// starts with
+
+#ifndef CPROVER_ANSI_C_PRECOMPILED_HEADER_H
+#define CPROVER_ANSI_C_PRECOMPILED_HEADER_H
+
+#include <util/optional.h>
+#include <util/symbol_table.h>
+
+#include "ansi_c_scope.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+/// The state of the C front end once it has parsed and typechecked the
+/// built-in declarations and the headers that a translation unit starts
+/// with. A translation unit that starts with the same headers, as seen after
+/// preprocessing, continues from this state rather than parsing and
+/// typechecking the headers again.
+///
+/// Precompiled headers are kept in a directory, named by a hash of their
+/// key, see \ref precompiled_header_key. Each file keeps the key, such that
+/// a file whose name collides with that of another key is not used. A file
+/// is written under a unique name and then renamed, such that parallel runs
+/// can share a directory.
+class precompiled_headert
+{
+public:
+  /// The key that the file is read and written with
+  std::string key;
+
+  /// The identifiers in the global scope of the parser
+  ansi_c_scopet::name_mapt names;
+
+  /// The asm labels of the typechecked declarations, which apply to later
+  /// declarations of the same translation unit
+  std::unordered_map<irep_idt, irep_idt> asm_labels;
+
+  /// The typechecked declarations
+  symbol_tablet symbol_table;
+
+  /// \return true on error, or if \p file_name was written with another
+  ///   key, false otherwise
+  bool read(const std::string &file_name);
+
+  /// Write to \p file_name, which is replaced as a whole
+  /// \return true on error, false otherwise
+  bool write(const std::string &file_name) const;
+};
+
+/// Split preprocessed text into the headers that it starts with and the
+/// rest, which starts with the first line of the main file that is neither
+/// blank nor a line marker. Line markers of the main file are left out of the
+/// headers, such that translation units that start with the same headers
+/// have the same headers text.
+/// \return the headers and the rest, or an empty optional if the text does
+///   not start with any header
+optionalt<std::pair<std::string, std::string>>
+split_precompiled_header(const std::string &preprocessed);
+
+/// \return the key of the precompiled header of \p headers, preceded by the
+///   built-in declarations \p built_in, which consists of their text, the
+///   configuration that affects typechecking, the working directory, and the
+///   version of this tool
+std::string
+precompiled_header_key(const std::string &built_in, const std::string &headers);
+
+/// \return the name of the file in \p directory that keeps the precompiled
+///   header with the key \p key
+std::string precompiled_header_file(
+  const std::string &directory,
+  const std::string &key);
+
+#endif // CPROVER_ANSI_C_PRECOMPILED_HEADER_H
@@ -74,6 +74,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <langapi/mode.h>
 
 #include "c_test_input_generator.h"
+#include "incremental_cache.h"
+#include "static_prepass.h"
 
 cbmc_parse_optionst::cbmc_parse_optionst(int argc, const char **argv)
   : parse_options_baset(
@@ -140,6 +142,39 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
     exit(CPROVER_EXIT_USAGE_ERROR);
   }
 
+  if(cmdline.isset("static-prepass"))
+  {
+    const std::string domain = cmdline.get_value("static-prepass");
+    if(domain != "constants" && domain != "vsd")
+    {
+      log.error() << "--static-prepass expects one of constants or vsd"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    if(cmdline.isset("cover"))
+    {
+      log.error() << "--cover and --static-prepass must not be given together"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option("static-prepass", domain);
+  }
+
+  if(cmdline.isset("incremental-cache"))
+  {
+    if(cmdline.isset("cover"))
+    {
+      log.error() << "--cover and --incremental-cache must not be given "
+                  << "together" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option(
+      "incremental-cache", cmdline.get_value("incremental-cache"));
+  }
+
   if(cmdline.isset("max-field-sensitivity-array-size"))
   {
     options.set_option(
@@ -159,6 +194,21 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
     options.set_option("no-array-field-sensitivity", true);
   }
 
+  if(cmdline.isset("sparse-array-field-sensitivity"))
+    options.set_option("sparse-array-field-sensitivity", true);
+
+  if(cmdline.isset("symex-profile"))
+  {
+    if(cmdline.isset("paths"))
+    {
+      log.error() << "--symex-profile not supported with --paths"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option("symex-profile", cmdline.get_value("symex-profile"));
+  }
+
   if(cmdline.isset("reachability-slice") &&
      cmdline.isset("reachability-slice-fb"))
   {
@@ -188,6 +238,37 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("show-vcc"))
     options.set_option("show-vcc", true);
 
+  if(cmdline.isset("write-equation") || cmdline.isset("read-equation"))
+  {
+    if(cmdline.isset("paths") || cmdline.isset("incremental-loop"))
+    {
+      log.error() << "--write-equation and --read-equation are not supported "
+                  << "with --paths or --incremental-loop" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    // the memory model constraints are added after the equation is written,
+    // while refining them
+    if(cmdline.isset("refine-memory-model"))
+    {
+      log.error() << "--write-equation and --read-equation are not supported "
+                  << "with --refine-memory-model" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    if(cmdline.isset("write-equation") && cmdline.isset("read-equation"))
+    {
+      log.error() << "--write-equation and --read-equation are mutually "
+                  << "exclusive" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    if(cmdline.isset("write-equation"))
+      options.set_option("write-equation", cmdline.get_value("write-equation"));
+    if(cmdline.isset("read-equation"))
+      options.set_option("read-equation", cmdline.get_value("read-equation"));
+  }
+
   if(cmdline.isset("cover"))
     parse_cover_options(cmdline, options);
 
@@ -378,6 +459,27 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   }
 
   parse_solver_options(cmdline, options);
+
+  if(cmdline.isset("refine-memory-model"))
+  {
+    // the formula and the VCCs would be output without the constraints that
+    // are only added while refining
+    if(
+      cmdline.isset("dimacs") || cmdline.isset("outfile") ||
+      cmdline.isset("show-vcc") || cmdline.isset("program-only") ||
+      cmdline.isset("show-byte-ops"))
+    {
+      log.error() << "--refine-memory-model is not supported with --dimacs, "
+                  << "--outfile, --show-vcc, --program-only or --show-byte-ops"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option("refine-memory-model", true);
+    // constraints are added after solving, which the SAT preprocessor does
+    // not support
+    options.set_option("sat-preprocessor", false);
+  }
 }
 
 /// invoke main modules
@@ -526,7 +628,8 @@ int cbmc_parse_optionst::doit()
   if(
     options.get_bool_option("program-only") ||
     options.get_bool_option("show-vcc") ||
-    options.get_bool_option("show-byte-ops"))
+    options.get_bool_option("show-byte-ops") ||
+    options.is_set("write-equation"))
   {
     if(options.get_bool_option("paths"))
     {
@@ -579,6 +682,15 @@ int cbmc_parse_optionst::doit()
     return CPROVER_EXIT_SUCCESS;
   }
 
+  // reuse results of the previous run?
+  std::unique_ptr<incremental_cachet> incremental_cache;
+  if(options.is_set("incremental-cache"))
+  {
+    incremental_cache = util_make_unique<incremental_cachet>(
+      options.get_option("incremental-cache"), options, ui_message_handler);
+    incremental_cache->discharge(goto_model);
+  }
+
   std::unique_ptr<goto_verifiert> verifier = nullptr;
 
   if(options.is_set("incremental-loop"))
@@ -693,6 +805,9 @@ int cbmc_parse_optionst::doit()
   const resultt result = (*verifier)();
   verifier->report();
 
+  if(incremental_cache)
+    incremental_cache->store(goto_model, verifier->get_properties());
+
   return result_to_exit_code(result);
 }
 
@@ -854,6 +969,15 @@ bool cbmc_parse_optionst::process_goto_program(
   // this would cause the property identifiers to change.
   label_properties(goto_model);
 
+  // discharge properties using abstract interpretation?
+  if(options.is_set("static-prepass"))
+  {
+    static_prepass(
+      goto_model,
+      options.get_option("static-prepass"),
+      log.get_message_handler());
+  }
+
   // reachability slice?
   if(options.get_bool_option("reachability-slice-fb"))
   {
@@ -945,10 +1069,19 @@ void cbmc_parse_optionst::help()
     HELP_GOTO_CHECK
     HELP_COVER
     " --mm MM                      memory consistency model for concurrent programs (default: sc)\n" // NOLINT(*)
+    " --refine-memory-model        add write-serialisation and from-read constraints\n" // NOLINT(*)
+    "                              of the memory model lazily\n" // NOLINT(*)
     HELP_CONFIG_LIBRARY
     HELP_REACHABILITY_SLICER
     HELP_REACHABILITY_SLICER_FB
     " --full-slice                 run full slicer (experimental)\n" // NOLINT(*)
+    " --static-prepass domain      prove properties by abstract interpretation\n" // NOLINT(*)
+    "                              before BMC, where domain is one of\n"
+    "                              constants or vsd\n"
+    " --incremental-cache dir      reuse the results of properties that passed\n" // NOLINT(*)
+    "                              in the previous run and are not impacted\n"
+    "                              by the changes since, and store the\n"
+    "                              results of this run in dir\n"
     " --drop-unused-functions      drop functions trivially unreachable from main function\n" // NOLINT(*)
     " --havoc-undefined-functions\n"
     "                              for any function that has no body, assign non-deterministic values to\n" // NOLINT(*)
@@ -960,6 +1093,9 @@ void cbmc_parse_optionst::help()
     "\n"
     "BMC options:\n"
     HELP_BMC
+    " --write-equation file        write the SSA equation to file in binary format\n" // NOLINT(*)
+    " --read-equation file         read the SSA equation from file instead of\n" // NOLINT(*)
+    "                              running symbolic execution\n" // NOLINT(*)
     "\n"
     "Backend options:\n"
     HELP_CONFIG_BACKEND
@@ -37,6 +37,8 @@ class optionst;
   "(preprocess)(slice-by-trace):" \
   OPT_FUNCTIONS \
   "(no-simplify)(full-slice)" \
+  "(static-prepass):" \
+  "(incremental-cache):" \
   OPT_REACHABILITY_SLICER \
   "(no-propagation)(no-simplify-if)" \
   "(document-subgoals)(test-preprocessor)" \
@@ -66,6 +68,8 @@ class optionst;
   OPT_COVER \
   "(symex-coverage-report):" \
   "(mm):" \
+  "(refine-memory-model)" \
+  "(write-equation):(read-equation):" \
   OPT_TIMESTAMP \
   "(arrays-uf-always)(arrays-uf-never)" \
   OPT_FLUSH \
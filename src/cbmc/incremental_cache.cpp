@@ -0,0 +1,237 @@
+/*******************************************************************\
+
+Module: Cache of Verification Results for Incremental Verification
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Cache of verification results for incremental verification
+
+#include "incremental_cache.h"
+
+#include <util/file_util.h>
+#include <util/json.h>
+#include <util/options.h>
+#include <util/std_expr.h>
+#include <util/version.h>
+
+#include <goto-programs/goto_model.h>
+#include <goto-programs/read_goto_binary.h>
+#include <goto-programs/write_goto_binary.h>
+
+#include <goto-diff/change_impact.h>
+
+#include <json/json_parser.h>
+
+#include <fstream>
+#include <sstream>
+
+/// \return true if \p symbol_table declares the same symbols as
+///   \p previous, with the same types and, other than for functions, the
+///   same values, ignoring comments such as source locations
+static bool same_declarations(
+  const symbol_tablet &previous,
+  const symbol_tablet &symbol_table)
+{
+  if(previous.symbols.size() != symbol_table.symbols.size())
+    return false;
+
+  for(const auto &named_symbol : symbol_table.symbols)
+  {
+    const symbolt &symbol = named_symbol.second;
+    const symbolt *previous_symbol = previous.lookup(named_symbol.first);
+    if(
+      previous_symbol == nullptr || previous_symbol->type != symbol.type ||
+      previous_symbol->is_type != symbol.is_type ||
+      previous_symbol->is_macro != symbol.is_macro ||
+      previous_symbol->is_static_lifetime != symbol.is_static_lifetime ||
+      (symbol.type.id() != ID_code && previous_symbol->value != symbol.value))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/// \return true if \p goto_functions has the same functions as \p previous,
+///   with the same bodies
+static bool same_functions(
+  const goto_functionst &previous,
+  const goto_functionst &goto_functions)
+{
+  if(previous.function_map.size() != goto_functions.function_map.size())
+    return false;
+
+  for(const auto &gf_entry : goto_functions.function_map)
+  {
+    const auto previous_entry = previous.function_map.find(gf_entry.first);
+    if(
+      previous_entry == previous.function_map.end() ||
+      !previous_entry->second.body.equals(gf_entry.second.body))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+incremental_cachet::incremental_cachet(
+  const std::string &directory,
+  const optionst &options,
+  message_handlert &message_handler)
+  : directory(directory), log(message_handler)
+{
+  optionst relevant_options = options;
+  relevant_options.set_option("incremental-cache", optionst::value_listt());
+
+  std::ostringstream out;
+  out << CBMC_VERSION << '\n' << relevant_options.to_json();
+  configuration = out.str();
+}
+
+std::string incremental_cachet::model_file() const
+{
+  return concat_dir_file(directory, "model.gb");
+}
+
+std::string incremental_cachet::results_file() const
+{
+  return concat_dir_file(directory, "results.json");
+}
+
+std::size_t incremental_cachet::discharge(goto_modelt &goto_model)
+{
+  if(!file_exists(results_file()))
+  {
+    log.status() << "Incremental cache is empty" << messaget::eom;
+    return 0;
+  }
+
+  jsont results;
+  if(
+    parse_json(results_file(), log.get_message_handler(), results) ||
+    !results.is_object())
+  {
+    log.warning() << "Failed to read " << results_file() << messaget::eom;
+    return 0;
+  }
+
+  if(results["configuration"].value != configuration)
+  {
+    log.status() << "Incremental cache was created with different options"
+                 << messaget::eom;
+    return 0;
+  }
+
+  auto previous_model =
+    read_goto_binary(model_file(), log.get_message_handler());
+  if(!previous_model.has_value())
+  {
+    log.warning() << "Failed to read " << model_file() << messaget::eom;
+    return 0;
+  }
+
+  // the impact analysis only considers the bodies of functions, and misses
+  // changes of types and of initial values
+  if(!same_declarations(previous_model->symbol_table, goto_model.symbol_table))
+  {
+    log.status() << "Declarations have changed since the incremental cache "
+                 << "was created" << messaget::eom;
+    return 0;
+  }
+
+  unchanged =
+    same_functions(previous_model->goto_functions, goto_model.goto_functions);
+
+  std::set<irep_idt> impacted;
+  if(!unchanged)
+  {
+    log.status() << "Computing the impact of the changes" << messaget::eom;
+    impacted = impacted_properties(*previous_model, goto_model);
+  }
+
+  const jsont &passed = results["passed"];
+  if(!passed.is_array())
+    return 0;
+
+  std::set<irep_idt> passed_properties;
+  for(const auto &property : to_json_array(passed))
+    passed_properties.insert(property.value);
+
+  std::size_t assertions = 0;
+  for(auto &gf_entry : goto_model.goto_functions.function_map)
+  {
+    for(auto it = gf_entry.second.body.instructions.begin();
+        it != gf_entry.second.body.instructions.end();
+        ++it)
+    {
+      if(!it->is_assert())
+        continue;
+
+      ++assertions;
+
+      const irep_idt &property_id = it->source_location().get_property_id();
+      if(
+        passed_properties.count(property_id) == 0 ||
+        impacted.count(property_id) != 0)
+      {
+        continue;
+      }
+
+      discharged.emplace_back(it, it->condition());
+      it->condition_nonconst() = true_exprt();
+    }
+  }
+
+  log.status() << "Reusing the results of " << discharged.size() << " of "
+               << assertions << " properties from the incremental cache"
+               << messaget::eom;
+
+  return discharged.size();
+}
+
+void incremental_cachet::store(
+  goto_modelt &goto_model,
+  const propertiest &properties)
+{
+  for(auto &entry : discharged)
+    entry.first->condition_nonconst() = std::move(entry.second);
+  discharged.clear();
+
+  if(!is_directory(directory) && !create_directory(directory))
+  {
+    log.warning() << "Failed to create " << directory << messaget::eom;
+    return;
+  }
+
+  if(
+    !unchanged &&
+    write_goto_binary(model_file(), goto_model, log.get_message_handler()))
+  {
+    return;
+  }
+
+  json_objectt results;
+  results["configuration"] = json_stringt(configuration);
+
+  json_arrayt passed;
+  for(const auto &property : properties)
+  {
+    if(property.second.status == property_statust::PASS)
+      passed.push_back(json_stringt(property.first));
+  }
+  results["passed"] = std::move(passed);
+
+  std::ofstream out(results_file());
+  if(!out)
+  {
+    log.warning() << "Failed to write " << results_file() << messaget::eom;
+    return;
+  }
+
+  out << results << '\n';
+}
@@ -0,0 +1,75 @@
+/*******************************************************************\
+
+Module: Cache of Verification Results for Incremental Verification
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Cache of verification results for incremental verification
+
+#ifndef CPROVER_CBMC_INCREMENTAL_CACHE_H
+#define CPROVER_CBMC_INCREMENTAL_CACHE_H
+
+#include <util/message.h>
+
+#include <goto-programs/goto_program.h>
+
+#include <goto-checker/properties.h>
+
+#include <string>
+#include <vector>
+
+class goto_modelt;
+class optionst;
+
+/// Keeps the goto model and the passing properties of the previous run in a
+/// directory. When the program is verified again with the same options, the
+/// properties that passed before and that are not impacted by the changes
+/// (as determined by goto-diff's change impact analysis) have their condition
+/// replaced by true, so that they are reported as passing without being
+/// verified again.
+///
+/// Nothing is reused if a type or the initial value of a variable has
+/// changed, as the impact analysis only considers the bodies of functions.
+/// The impact analysis is skipped if no function has changed.
+class incremental_cachet
+{
+public:
+  /// \param directory: directory that holds the cache, which is created when
+  ///   the results are stored
+  /// \param options: the options of this run; results are only reused if they
+  ///   were obtained with the same options
+  /// \param message_handler: message handler
+  incremental_cachet(
+    const std::string &directory,
+    const optionst &options,
+    message_handlert &message_handler);
+
+  /// Discharge the properties of \p goto_model whose result is known from the
+  /// previous run and cannot have changed.
+  /// \return the number of properties that were discharged
+  std::size_t discharge(goto_modelt &goto_model);
+
+  /// Store \p goto_model and the properties in \p properties that pass, for
+  /// use by the next run. The conditions of the properties that were
+  /// discharged are restored first.
+  void store(goto_modelt &goto_model, const propertiest &properties);
+
+protected:
+  const std::string directory;
+  std::string configuration;
+  messaget log;
+
+  /// True if the goto model is the same as in the previous run
+  bool unchanged = false;
+
+  /// The original conditions of the discharged properties
+  std::vector<std::pair<goto_programt::targett, exprt>> discharged;
+
+  std::string model_file() const;
+  std::string results_file() const;
+};
+
+#endif // CPROVER_CBMC_INCREMENTAL_CACHE_H
@@ -0,0 +1,103 @@
+/*******************************************************************\
+
+Module: Discharge Properties by Abstract Interpretation
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Discharge properties by abstract interpretation before running BMC
+
+#include "static_prepass.h"
+
+#include <util/invariant.h>
+#include <util/message.h>
+#include <util/options.h>
+
+#include <goto-programs/goto_model.h>
+
+#include <analyses/ai.h>
+
+#include <goto-analyzer/build_analyzer.h>
+#include <goto-analyzer/static_verifier.h>
+
+std::size_t static_prepass(
+  goto_modelt &goto_model,
+  const std::string &domain,
+  message_handlert &message_handler)
+{
+  messaget log(message_handler);
+
+  // the analyses do not consider the interleavings of threads, such that an
+  // assertion could be discharged that another thread makes fail
+  for(const auto &gf_entry : goto_model.goto_functions.function_map)
+  {
+    for(const auto &instruction : gf_entry.second.body.instructions)
+    {
+      if(instruction.is_start_thread())
+      {
+        log.warning() << "Skipping --static-prepass, as the program starts "
+                      << "threads" << messaget::eom;
+        return 0;
+      }
+    }
+  }
+
+  optionst options;
+  options.set_option("recursive-interprocedural", true);
+  options.set_option("ahistorical", true);
+  options.set_option("one-domain-per-history", true);
+
+  // interval_domaint is not offered, as it ignores writes through pointers
+  if(domain == "constants")
+    options.set_option("constants", true);
+  else
+  {
+    PRECONDITION(domain == "vsd");
+    options.set_option("vsd", true);
+    options.set_option("values", "intervals");
+    options.set_option("structs", "every-field");
+    options.set_option("arrays", "every-element");
+    options.set_option("pointers", "constants");
+  }
+
+  log.status() << "Running abstract interpretation with the " << domain
+               << " domain" << messaget::eom;
+
+  const namespacet ns(goto_model.symbol_table);
+  std::unique_ptr<ai_baset> analyzer =
+    build_analyzer(options, goto_model, ns, message_handler);
+  CHECK_RETURN(analyzer != nullptr);
+  (*analyzer)(goto_model);
+
+  std::size_t assertions = 0;
+  std::size_t discharged = 0;
+
+  for(auto &gf_entry : goto_model.goto_functions.function_map)
+  {
+    for(auto it = gf_entry.second.body.instructions.begin();
+        it != gf_entry.second.body.instructions.end();
+        ++it)
+    {
+      if(!it->is_assert() || it->condition().is_true())
+        continue;
+
+      ++assertions;
+
+      const static_verifier_resultt result(*analyzer, it, gf_entry.first, ns);
+      if(
+        result.status == ai_verifier_statust::TRUE ||
+        result.status == ai_verifier_statust::NOT_REACHABLE)
+      {
+        it->condition_nonconst() = true_exprt();
+        ++discharged;
+      }
+    }
+  }
+
+  log.status() << "Abstract interpretation discharged " << discharged
+               << " of " << assertions << " properties" << messaget::eom;
+
+  return discharged;
+}
@@ -0,0 +1,34 @@
+/*******************************************************************\
+
+Module: Discharge Properties by Abstract Interpretation
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Discharge properties by abstract interpretation before running BMC
+
+#ifndef CPROVER_CBMC_STATIC_PREPASS_H
+#define CPROVER_CBMC_STATIC_PREPASS_H
+
+#include <cstddef>
+#include <string>
+
+class goto_modelt;
+class message_handlert;
+
+/// Run abstract interpretation with the domain \p domain, which is either
+/// `constants` or `vsd`, and replace the condition of every assertion that
+/// the analysis proves to hold, or to be unreachable, by true.
+/// Symbolic execution does not generate verification conditions for these
+/// assertions, and the verifiers report them as passing.
+/// Nothing is discharged if \p goto_model starts threads, as the analyses
+/// do not take interleavings into account.
+/// \return the number of assertions that were discharged
+std::size_t static_prepass(
+  goto_modelt &goto_model,
+  const std::string &domain,
+  message_handlert &message_handler);
+
+#endif // CPROVER_CBMC_STATIC_PREPASS_H
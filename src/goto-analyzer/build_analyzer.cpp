@@ -9,29 +9,34 @@ Author: Martin Brain, martin.brain@cs.ox.ac.uk
 #include "build_analyzer.h"
 
 #include <analyses/ai.h>
+#include <analyses/ai_summary_interprocedural.h>
 #include <analyses/call_stack_history.h>
 #include <analyses/constant_propagator.h>
 #include <analyses/dependence_graph.h>
 #include <analyses/interval_domain.h>
 #include <analyses/local_control_flow_history.h>
+#include <analyses/sparse_history_storage.h>
 #include <analyses/variable-sensitivity/three_way_merge_abstract_interpreter.h>
 #include <analyses/variable-sensitivity/variable_sensitivity_configuration.h>
 #include <analyses/variable-sensitivity/variable_sensitivity_dependence_graph.h>
 #include <analyses/variable-sensitivity/variable_sensitivity_domain.h>
 #include <analyses/variable-sensitivity/variable_sensitivity_object_factory.h>
+#include <analyses/weak_topological_order.h>
+#include <analyses/wto_history.h>
 
 #include <goto-programs/goto_model.h>
 
 #include <util/message.h>
 #include <util/options.h>
 
-/// Ideally this should be a pure function of options.
-/// However at the moment some domains require the goto_model or parts of it
-std::unique_ptr<ai_baset> build_analyzer(
+/// Build the abstract interpreter selected by \p options, using \p order to
+/// decide where to widen if it is set
+static std::unique_ptr<ai_baset> build_analyzer(
   const optionst &options,
   const goto_modelt &goto_model,
   const namespacet &ns,
-  message_handlert &mh)
+  message_handlert &mh,
+  const std::shared_ptr<const weak_topological_ordert> &order)
 {
   auto vsd_config = vsd_configt::from_options(options);
   auto vs_object_factory =
@@ -40,11 +45,16 @@ std::unique_ptr<ai_baset> build_analyzer(
   // These support all of the option categories
   if(
     options.get_bool_option("recursive-interprocedural") ||
+    options.get_bool_option("summary-interprocedural") ||
     options.get_bool_option("three-way-merge"))
   {
     // Build the history factory
     std::unique_ptr<ai_history_factory_baset> hf = nullptr;
-    if(options.get_bool_option("ahistorical"))
+    if(options.get_bool_option("ahistorical") && order != nullptr)
+    {
+      hf = util_make_unique<wto_history_factoryt>(order);
+    }
+    else if(options.get_bool_option("ahistorical"))
     {
       hf = util_make_unique<
         ai_history_factory_default_constructort<ahistoricalt>>();
@@ -85,6 +95,7 @@ std::unique_ptr<ai_baset> build_analyzer(
 
     // Build the storage object
     std::unique_ptr<ai_storage_baset> st = nullptr;
+    sparse_history_storaget *sparse_storage = nullptr;
     if(options.get_bool_option("one-domain-per-history"))
     {
       st = util_make_unique<history_sensitive_storaget>();
@@ -93,14 +104,27 @@ std::unique_ptr<ai_baset> build_analyzer(
     {
       st = util_make_unique<location_sensitive_storaget>();
     }
+    else if(options.get_bool_option("sparse-storage"))
+    {
+      auto sparse = util_make_unique<sparse_history_storaget>(
+        goto_model.goto_functions, ns);
+      sparse_storage = sparse.get();
+      st = std::move(sparse);
+    }
 
     // Only try to build the abstract interpreter if all the parts have been
     // correctly specified and configured
+    std::unique_ptr<ai_baset> ai = nullptr;
     if(hf != nullptr && df != nullptr && st != nullptr)
     {
       if(options.get_bool_option("recursive-interprocedural"))
       {
-        return util_make_unique<ai_recursive_interproceduralt>(
+        ai = util_make_unique<ai_recursive_interproceduralt>(
+          std::move(hf), std::move(df), std::move(st), mh);
+      }
+      else if(options.get_bool_option("summary-interprocedural"))
+      {
+        ai = util_make_unique<ai_summary_interproceduralt>(
           std::move(hf), std::move(df), std::move(st), mh);
       }
       else if(options.get_bool_option("three-way-merge"))
@@ -108,11 +132,18 @@ std::unique_ptr<ai_baset> build_analyzer(
         // Only works with VSD
         if(options.get_bool_option("vsd"))
         {
-          return util_make_unique<ai_three_way_merget>(
+          ai = util_make_unique<ai_three_way_merget>(
             std::move(hf), std::move(df), std::move(st), mh);
         }
       }
     }
+
+    // Recomputing pruned domains requires the abstract interpreter
+    if(ai != nullptr && sparse_storage != nullptr)
+      sparse_storage->set_analyzer(*ai);
+
+    if(ai != nullptr)
+      return ai;
   }
   else if(options.get_bool_option("legacy-ait"))
   {
@@ -165,3 +196,25 @@ std::unique_ptr<ai_baset> build_analyzer(
   // Construction failed due to configuration errors
   return nullptr;
 }
+
+/// Ideally this should be a pure function of options.
+/// However at the moment some domains require the goto_model or parts of it
+std::unique_ptr<ai_baset> build_analyzer(
+  const optionst &options,
+  const goto_modelt &goto_model,
+  const namespacet &ns,
+  message_handlert &mh)
+{
+  std::shared_ptr<const weak_topological_ordert> order;
+  if(options.get_bool_option("wto"))
+  {
+    order =
+      std::make_shared<weak_topological_ordert>(goto_model.goto_functions);
+  }
+
+  auto analyzer = build_analyzer(options, goto_model, ns, mh, order);
+  if(analyzer != nullptr && order != nullptr)
+    analyzer->set_iteration_order(order);
+
+  return analyzer;
+}
@@ -190,6 +190,8 @@ void goto_analyzer_parse_optionst::get_command_line_options(optionst &options)
     // Abstract interpreter choice
     if(cmdline.isset("recursive-interprocedural"))
       options.set_option("recursive-interprocedural", true);
+    else if(cmdline.isset("summary-interprocedural"))
+      options.set_option("summary-interprocedural", true);
     else if(cmdline.isset("three-way-merge"))
       options.set_option("three-way-merge", true);
     else if(cmdline.isset("legacy-ait") || cmdline.isset("location-sensitive"))
@@ -220,6 +222,23 @@ void goto_analyzer_parse_optionst::get_command_line_options(optionst &options)
       options.set_option("storage set", true);
     }
 
+    // The legacy interpreters have their own storage
+    if(
+      cmdline.isset("sparse-storage") &&
+      (options.get_bool_option("legacy-ait") ||
+       options.get_bool_option("legacy-concurrent")))
+    {
+      throw invalid_command_line_argument_exceptiont(
+        "only supported by the history-aware abstract interpreters",
+        "--sparse-storage",
+        "use --recursive-interprocedural, --summary-interprocedural or "
+        "--three-way-merge");
+    }
+
+    // Iteration strategy
+    if(cmdline.isset("wto"))
+      options.set_option("wto", true);
+
     // History choice
     if(cmdline.isset("ahistorical"))
     {
@@ -341,6 +360,11 @@ void goto_analyzer_parse_optionst::get_command_line_options(optionst &options)
     options.set_option("one-domain-per-location", true);
     options.set_option("storage set", true);
   }
+  else if(cmdline.isset("sparse-storage"))
+  {
+    options.set_option("sparse-storage", true);
+    options.set_option("storage set", true);
+  }
 
   if(!options.get_bool_option("storage set"))
   {
@@ -593,6 +617,9 @@ int goto_analyzer_parse_optionst::perform_analysis(const optionst &options)
     // Run
     log.status() << "Computing abstract states" << messaget::eom;
     (*analyzer)(goto_model);
+    log.statistics() << "Abstract interpretation took "
+                     << analyzer->get_iteration_count() << " iterations"
+                     << messaget::eom;
 
     // Perform the task
     log.status() << "Performing task" << messaget::eom;
@@ -711,11 +738,19 @@ void goto_analyzer_parse_optionst::help()
     // NOLINTNEXTLINE(whitespace/line_length)
     " --recursive-interprocedural  use recursion to handle interprocedural reasoning\n"
     // NOLINTNEXTLINE(whitespace/line_length)
+    " --summary-interprocedural    like --recursive-interprocedural, but reuse the\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    "                              results of calls to non-recursive functions\n"
+    "                              with the same input state\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
     " --three-way-merge            use VSD's three-way merge on return from function call\n"
     // NOLINTNEXTLINE(whitespace/line_length)
     " --legacy-ait                 recursion for function and one domain per location\n"
     // NOLINTNEXTLINE(whitespace/line_length)
     " --legacy-concurrent          legacy-ait with an extended fixed-point for concurrency\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    " --wto                        iterate in weak topological order and, with\n"
+    "                              --ahistorical, only widen at loop heads\n"
     "\n"
     "History options:\n"
     // NOLINTNEXTLINE(whitespace/line_length)
@@ -752,6 +787,10 @@ void goto_analyzer_parse_optionst::help()
     // NOLINTNEXTLINE(whitespace/line_length)
     " --one-domain-per-history     stores a domain for each history object created\n"
     " --one-domain-per-location    stores a domain for each location reached\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    " --sparse-storage             stores a domain for each history at joins and\n"
+    // NOLINTNEXTLINE(whitespace/line_length)
+    "                              calls only and recomputes the others on demand\n"
     "\n"
     "Output options:\n"
     " --text file_name             output results in plain text to given file\n"
@@ -113,9 +113,11 @@ class optionst;
 
 #define GOTO_ANALYSER_OPTIONS_AI \
   "(recursive-interprocedural)" \
+  "(summary-interprocedural)" \
   "(three-way-merge)" \
   "(legacy-ait)" \
-  "(legacy-concurrent)"
+  "(legacy-concurrent)" \
+  "(wto)"
 
 #define GOTO_ANALYSER_OPTIONS_HISTORY \
   "(ahistorical)" \
@@ -134,7 +136,8 @@ class optionst;
 
 #define GOTO_ANALYSER_OPTIONS_STORAGE \
   "(one-domain-per-history)" \
-  "(one-domain-per-location)"
+  "(one-domain-per-location)" \
+  "(sparse-storage)"
 
 #define GOTO_ANALYSER_OPTIONS_OUTPUT \
   "(json):(xml):" \
@@ -13,16 +13,24 @@ Date: June 2006
 
 #include "compile.h"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <random>
+#include <sstream>
 
+#include <util/cache_key.h>
 #include <util/cmdline.h>
 #include <util/config.h>
+#include <util/exception_utils.h>
 #include <util/file_util.h>
 #include <util/get_base_name.h>
 #include <util/prefix.h>
 #include <util/run.h>
+#include <util/signal_catcher.h>
+#include <util/string2int.h>
+#include <util/string_hash.h>
 #include <util/symbol_table_builder.h>
 #include <util/tempdir.h>
 #include <util/tempfile.h>
@@ -32,12 +40,22 @@ Date: June 2006
 #  include <util/unicode.h>
 #endif
 
+#ifndef _WIN32
+#  include <sys/wait.h>
+#  include <cerrno>
+#  include <csignal>
+#  include <unistd.h>
+#endif
+
 #include <ansi-c/ansi_c_entry_point.h>
 #include <ansi-c/c_object_factory_parameters.h>
 
 #include <goto-programs/goto_convert_functions.h>
+#include <goto-programs/goto_functions.h>
 #include <goto-programs/name_mangler.h>
+#include <goto-programs/read_bin_goto_object.h>
 #include <goto-programs/read_goto_binary.h>
+#include <goto-programs/remove_unused_functions.h>
 #include <goto-programs/write_goto_binary.h>
 
 #include <langapi/language.h>
@@ -61,6 +79,33 @@ bool compilet::doit()
 {
   add_compiler_specific_defines();
 
+  if(cmdline.isset("jobs"))
+  {
+    const auto parsed_jobs = string2optional_size_t(cmdline.get_value("jobs"));
+    if(!parsed_jobs.has_value() || *parsed_jobs == 0)
+    {
+      log.error() << "--jobs expects a positive number" << messaget::eom;
+      return true;
+    }
+
+#ifdef _WIN32
+    if(*parsed_jobs > 1)
+    {
+      log.warning() << "--jobs is not supported on Windows, ignoring it"
+                    << messaget::eom;
+    }
+#else
+    jobs = std::min(*parsed_jobs, max_registered_children);
+#endif
+  }
+
+  if(cmdline.isset("object-cache"))
+    object_cache = cmdline.get_value("object-cache");
+
+  drop_unused_functions = cmdline.isset("drop-unused-functions");
+  if(cmdline.isset("keep-function"))
+    functions_to_keep = cmdline.get_values("keep-function");
+
   // Parse command line for source and object file names
   for(const auto &arg : cmdline.args)
     if(add_input_file(arg))
@@ -114,8 +159,10 @@ bool compilet::doit()
       return true;
   }
 
-  return warning_is_fatal && log.get_message_handler().get_message_count(
-                               messaget::M_WARNING) != warnings_before;
+  return warning_is_fatal &&
+         (log.get_message_handler().get_message_count(messaget::M_WARNING) !=
+            warnings_before ||
+          warnings_in_parallel_jobs);
 }
 
 enum class file_typet
@@ -350,6 +397,17 @@ bool compilet::link(optionalt<symbol_tablet> &&symbol_table)
     convert_symbols(goto_model);
   }
 
+  if(drop_unused_functions)
+  {
+    // without an entry point, e.g. with goto-ld, the function that is to
+    // become the entry point is kept
+    std::set<irep_idt> roots{goto_functionst::entry_point(),
+                             config.main.value_or("main")};
+    roots.insert(functions_to_keep.begin(), functions_to_keep.end());
+
+    remove_unreachable_functions(goto_model, roots, log.get_message_handler());
+  }
+
   if(keep_file_local)
   {
     function_name_manglert<file_name_manglert> mangler(
@@ -370,6 +428,18 @@ optionalt<symbol_tablet> compilet::compile()
 {
   symbol_tablet symbol_table;
 
+  // Parsing and type checking are done in parallel, but the symbol tables are
+  // linked in the order of the source files, such that the result is the
+  // same whatever the number of jobs.
+  std::map<std::string, optionalt<std::string>> parsed_sources;
+  if(
+    jobs > 1 && source_files.size() > 1 && mode != PREPROCESS_ONLY &&
+    std::find(source_files.begin(), source_files.end(), "-") ==
+      source_files.end())
+  {
+    parsed_sources = parse_sources_in_parallel();
+  }
+
   while(!source_files.empty())
   {
     std::string file_name=source_files.front();
@@ -380,7 +450,17 @@ optionalt<symbol_tablet> compilet::compile()
     if(echo_file_name)
       std::cout << get_base_name(file_name, false) << '\n' << std::flush;
 
-    auto file_symbol_table = parse_source(file_name);
+    optionalt<symbol_tablet> file_symbol_table;
+    const auto parsed_source = parsed_sources.find(file_name);
+    if(parsed_source == parsed_sources.end())
+      file_symbol_table = parse_source(file_name);
+    else if(parsed_source->second.has_value())
+    {
+      auto parsed_model =
+        read_goto_binary(*parsed_source->second, log.get_message_handler());
+      if(parsed_model.has_value())
+        file_symbol_table = std::move(parsed_model->symbol_table);
+    }
 
     if(!file_symbol_table.has_value())
     {
@@ -446,26 +526,32 @@ optionalt<symbol_tablet> compilet::compile()
   return std::move(symbol_table);
 }
 
-/// parses a source file (low-level parsing)
-/// \return true on error, false otherwise
-bool compilet::parse(
-  const std::string &file_name,
-  language_filest &language_files)
+std::unique_ptr<languaget>
+compilet::get_language(const std::string &file_name) const
 {
-  std::unique_ptr<languaget> languagep;
-
   // Using '-x', the type of a file can be overridden;
   // otherwise, it's guessed from the extension.
 
   if(!override_language.empty())
   {
     if(override_language=="c++" || override_language=="c++-header")
-      languagep = get_language_from_mode(ID_cpp);
+      return get_language_from_mode(ID_cpp);
     else
-      languagep = get_language_from_mode(ID_C);
+      return get_language_from_mode(ID_C);
   }
   else if(file_name != "-")
-    languagep=get_language_from_filename(file_name);
+    return get_language_from_filename(file_name);
+
+  return nullptr;
+}
+
+/// parses a source file (low-level parsing)
+/// \return true on error, false otherwise
+bool compilet::parse(
+  const std::string &file_name,
+  language_filest &language_files)
+{
+  std::unique_ptr<languaget> languagep = get_language(file_name);
 
   if(languagep==nullptr)
   {
@@ -575,6 +661,7 @@ bool compilet::write_bin_object_file(
   const std::string &file_name,
   const goto_modelt &src_goto_model,
   bool validate_goto_model,
+  bool compress,
   message_handlert &message_handler)
 {
   messaget log(message_handler);
@@ -601,8 +688,12 @@ bool compilet::write_bin_object_file(
     return true;
   }
 
-  if(write_goto_binary(outfile, src_goto_model))
+  if(
+    compress ? write_compressed_goto_binary(outfile, src_goto_model)
+             : write_goto_binary(outfile, src_goto_model))
+  {
     return true;
+  }
 
   const auto cnt = function_body_count(src_goto_model.goto_functions);
 
@@ -619,6 +710,34 @@ bool compilet::write_bin_object_file(
 /// \return A symbol table if, and only if, parsing and type checking succeeded.
 optionalt<symbol_tablet> compilet::parse_source(const std::string &file_name)
 {
+  optionalt<std::pair<std::string, std::string>> cache_entry;
+  if(!object_cache.empty() && file_name != "-" && mode != PREPROCESS_ONLY)
+    cache_entry = object_cache_entry(file_name);
+
+  if(cache_entry.has_value() && file_exists(cache_entry->first))
+  {
+    std::ifstream in(cache_entry->first, std::ios::binary);
+    null_message_handlert null_message_handler;
+    symbol_tablet cached_symbol_table;
+    goto_functionst no_functions;
+    if(
+      in && !read_cache_key(in, cache_entry->second) &&
+      !read_bin_goto_object(
+        in,
+        cache_entry->first,
+        cached_symbol_table,
+        no_functions,
+        null_message_handler))
+    {
+      log.statistics() << "Reading from cache: " << file_name
+                       << messaget::eom;
+      return std::move(cached_symbol_table);
+    }
+  }
+
+  const unsigned warnings_before =
+    log.get_message_handler().get_message_count(messaget::M_WARNING);
+
   language_filest language_files;
   language_files.set_message_handler(log.get_message_handler());
 
@@ -639,9 +758,228 @@ optionalt<symbol_tablet> compilet::parse_source(const std::string &file_name)
     return {};
   }
 
+  // A cached file would not repeat its warnings, which may be fatal, hence
+  // only files without any are stored. Storing is best effort, and another
+  // run may be storing the same entry.
+  if(
+    cache_entry.has_value() &&
+    log.get_message_handler().get_message_count(messaget::M_WARNING) ==
+      warnings_before &&
+    (is_directory(object_cache) || create_directory(object_cache)))
+  {
+    const std::string temporary_file_name =
+      cache_entry->first + "." + std::to_string(std::random_device{}());
+
+    bool error;
+    {
+      std::ofstream out(temporary_file_name, std::ios::binary);
+      write_cache_key(out, cache_entry->second);
+      error =
+        !out || write_goto_binary(out, file_symbol_table, goto_functionst{});
+    }
+
+    try
+    {
+      if(error)
+        file_remove(temporary_file_name);
+      else
+        file_rename(temporary_file_name, cache_entry->first);
+    }
+    catch(const system_exceptiont &)
+    {
+      file_remove(temporary_file_name);
+    }
+  }
+
   return std::move(file_symbol_table);
 }
 
+optionalt<std::pair<std::string, std::string>>
+compilet::object_cache_entry(const std::string &file_name)
+{
+  // the text of files in other languages does not include the files that
+  // they depend on
+  std::unique_ptr<languaget> languagep = get_language(file_name);
+  if(
+    languagep == nullptr ||
+    (languagep->id() != "C" && languagep->id() != "cpp"))
+  {
+    return {};
+  }
+
+  // errors and warnings are repeated when the file is parsed
+  null_message_handlert null_message_handler;
+  languagep->set_message_handler(null_message_handler);
+
+#ifdef _MSC_VER
+  std::ifstream infile(widen(file_name));
+#else
+  std::ifstream infile(file_name);
+#endif
+
+  std::ostringstream preprocessed;
+  if(!infile || languagep->preprocess(infile, file_name, preprocessed))
+    return {};
+
+  // the working directory is part of the source locations
+  const std::string text = preprocessed.str();
+  std::string key =
+    std::string{CBMC_VERSION} + '\n' + languagep->id() + '\n' +
+    config.ansi_c.typecheck_settings() +
+    std::to_string(static_cast<int>(config.cpp.cpp_standard)) + '\n' +
+    get_current_working_directory() + '\n' + file_name + '\n' +
+    std::to_string(keep_file_local) + '\n' + text;
+
+  std::string entry = concat_dir_file(
+    object_cache,
+    std::to_string(hash_string(key)) + "-" + std::to_string(text.size()) +
+      ".gb");
+
+  return std::make_pair(std::move(entry), std::move(key));
+}
+
+std::map<std::string, optionalt<std::string>>
+compilet::parse_sources_in_parallel()
+{
+  std::map<std::string, optionalt<std::string>> result;
+
+#ifndef _WIN32
+  const std::string directory = get_temporary_directory("goto-cc.XXXXXX");
+  tmp_dirs.push_back(directory);
+
+  // the source file and the symbol table file of each running process
+  std::map<pid_t, std::pair<std::string, std::string>> running;
+
+  const auto wait_for_process = [&]() {
+    int status;
+    pid_t pid;
+    while((pid = waitpid(-1, &status, 0)) == -1 && errno == EINTR)
+      continue;
+
+    if(pid == -1)
+    {
+      log.error() << "waiting for child processes failed" << messaget::eom;
+      for(const auto &process : running)
+      {
+        unregister_child(process.first);
+        result.emplace(process.second.first, optionalt<std::string>{});
+      }
+      running.clear();
+      return;
+    }
+
+    const auto entry = running.find(pid);
+    if(entry == running.end())
+      return;
+
+    unregister_child(pid);
+
+    // 0 and 2 report success without and with warnings, respectively
+    if(
+      WIFEXITED(status) &&
+      (WEXITSTATUS(status) == 0 || WEXITSTATUS(status) == 2))
+    {
+      result.emplace(entry->second.first, entry->second.second);
+      if(WEXITSTATUS(status) == 2)
+        warnings_in_parallel_jobs = true;
+    }
+    else
+    {
+      if(!WIFEXITED(status))
+      {
+        log.error() << "parsing '" << entry->second.first
+                    << "' terminated abnormally" << messaget::eom;
+      }
+      result.emplace(entry->second.first, optionalt<std::string>{});
+    }
+
+    running.erase(entry);
+  };
+
+  std::size_t count = 0;
+  for(const auto &file_name : source_files)
+  {
+    if(result.count(file_name) != 0)
+      continue;
+
+    while(running.size() >= jobs)
+      wait_for_process();
+
+    const std::string symbol_table_file =
+      concat_dir_file(directory, std::to_string(count++) + ".gb");
+
+    // the children must not repeat buffered output
+    std::cout << std::flush;
+    std::cerr << std::flush;
+
+    // block SIGTERM until the child is registered to be terminated with us
+    sigset_t new_mask, old_mask;
+    sigemptyset(&new_mask);
+    sigaddset(&new_mask, SIGTERM);
+    sigprocmask(SIG_BLOCK, &new_mask, &old_mask);
+
+    const pid_t pid = fork();
+
+    if(pid == 0)
+    {
+      remove_signal_catcher();
+      sigprocmask(SIG_SETMASK, &old_mask, nullptr);
+
+      const unsigned warnings_before =
+        log.get_message_handler().get_message_count(messaget::M_WARNING);
+
+      int status = 1;
+
+      // an exception must not unwind into the frames of the parent, whose
+      // destructors would remove files that other processes still use
+      try
+      {
+        auto file_symbol_table = parse_source(file_name);
+        if(file_symbol_table.has_value())
+        {
+          std::ofstream out(symbol_table_file, std::ios::binary);
+          const goto_functionst no_functions;
+          if(out && !write_goto_binary(out, *file_symbol_table, no_functions))
+          {
+            status = log.get_message_handler().get_message_count(
+                       messaget::M_WARNING) != warnings_before
+                       ? 2
+                       : 0;
+          }
+        }
+
+        std::cout << std::flush;
+        std::cerr << std::flush;
+      }
+      catch(...)
+      {
+        _exit(1);
+      }
+
+      // neither run destructors nor exit handlers of the parent
+      _exit(status);
+    }
+
+    if(pid != -1)
+    {
+      register_child(pid);
+      running.emplace(pid, std::make_pair(file_name, symbol_table_file));
+    }
+
+    sigprocmask(SIG_SETMASK, &old_mask, nullptr);
+
+    // the remaining source files are parsed by the caller
+    if(pid == -1)
+      break;
+  }
+
+  while(!running.empty())
+    wait_for_process();
+#endif
+
+  return result;
+}
+
 /// constructor
 compilet::compilet(cmdlinet &_cmdline, message_handlert &mh, bool Werror)
   : log(mh),
@@ -19,6 +19,7 @@ Date: June 2006
 #include <util/symbol.h>
 
 #include <map>
+#include <memory>
 
 class cmdlinet;
 class goto_functionst;
@@ -34,6 +35,9 @@ class compilet
   bool echo_file_name;
   bool validate_goto_model = false;
 
+  /// Whether goto binaries are written compressed with deflate
+  bool compress_goto_binaries = false;
+
   enum { PREPROCESS_ONLY, // gcc -E
          COMPILE_ONLY, // gcc -c
          ASSEMBLE_ONLY, // gcc -S
@@ -53,6 +57,23 @@ class compilet
   // the two options below are mutually exclusive -- use either or
   std::string output_file_object, output_directory_object;
 
+  /// The number of source files that are parsed and type checked at the same
+  /// time, each in a process of its own
+  std::size_t jobs = 1;
+
+  /// Directory in which the symbol tables of type checked source files are
+  /// kept between runs, or empty if they are not cached
+  std::string object_cache;
+
+  /// Whether the functions, and the variables, that cannot be reached from
+  /// the entry point, the function set with --function, main, or
+  /// \ref functions_to_keep are dropped when linking
+  bool drop_unused_functions = false;
+
+  /// Further roots of the reachability that \ref drop_unused_functions
+  /// keeps functions by
+  std::list<std::string> functions_to_keep;
+
   compilet(cmdlinet &_cmdline, message_handlert &mh, bool Werror);
 
   ~compilet();
@@ -69,17 +90,27 @@ class compilet
 
   optionalt<symbol_tablet> parse_source(const std::string &);
 
+  /// Parse and type check the source files in up to \ref jobs processes at a
+  /// time, each of which writes the symbol table of its source file to a
+  /// temporary file.
+  /// \return by source file, the file that its symbol table has been written
+  ///   to, or an empty optional if parsing or type checking failed; source
+  ///   files that no process could be started for are missing
+  std::map<std::string, optionalt<std::string>> parse_sources_in_parallel();
+
   /// Writes the goto functions of \p src_goto_model to a binary format object
   /// file.
   /// \param file_name: Target file to serialize \p src_goto_model to
   /// \param src_goto_model: goto model to serialize
   /// \param validate_goto_model: enable goto-model validation
+  /// \param compress: write a compressed goto binary
   /// \param message_handler: message handler
   /// \return true on error, false otherwise
   static bool write_bin_object_file(
     const std::string &file_name,
     const goto_modelt &src_goto_model,
     bool validate_goto_model,
+    bool compress,
     message_handlert &message_handler);
 
   /// \brief Has this compiler written any object files?
@@ -126,6 +157,7 @@ class compilet
          file_name,
          src_goto_model,
          validate_goto_model,
+         compress_goto_binaries,
          log.get_message_handler()))
     {
       return true;
@@ -138,11 +170,29 @@ class compilet
 
   void add_compiler_specific_defines() const;
 
+  /// \return the language that \p file_name is in, or a null pointer if it
+  ///   cannot be determined
+  std::unique_ptr<languaget> get_language(const std::string &file_name) const;
+
+  /// Preprocess \p file_name and compute the key of its entry in
+  /// \ref object_cache, which consists of the preprocessed text, the
+  /// language, the configuration that affects type checking and the version
+  /// of this tool. The name of the entry is a hash of the key, and the entry
+  /// keeps the key to tell apart keys whose hashes collide.
+  /// \return the name and the key of the entry, or an empty optional if the
+  ///   file cannot be cached
+  optionalt<std::pair<std::string, std::string>>
+  object_cache_entry(const std::string &file_name);
+
   void convert_symbols(goto_modelt &);
 
   bool add_written_cprover_symbols(const symbol_tablet &symbol_table);
   std::map<irep_idt, symbolt> written_macros;
 
+  /// Whether any of the processes of \ref parse_sources_in_parallel has
+  /// issued warnings, which these do not count in our message handler
+  bool warnings_in_parallel_jobs = false;
+
   // clients must only call add_written_cprover_symbols() if an object
   // file has been written. The case where an object file was written
   // but there were no __CPROVER symbols in the goto-program is distinct
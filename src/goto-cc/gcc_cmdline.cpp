@@ -29,6 +29,10 @@ const char *goto_cc_options_with_separated_argument[]=
   "--print-rejected-preprocessed-source",
   "--mangle-suffix",
   "--object-bits",
+  "--jobs",
+  "--object-cache",
+  "--precompiled-headers",
+  "--keep-function",
   nullptr
 };
 
@@ -52,6 +56,8 @@ const char *goto_cc_options_without_argument[]=
   "--no-arch",
   "--partial-inlining",
   "--validate-goto-model",
+  "--compress-goto-binaries",
+  "--drop-unused-functions",
   "-?",
   "--export-file-local-symbols",
   // This is deprecated. Currently prints out a deprecation warning.
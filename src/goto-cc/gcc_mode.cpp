@@ -415,6 +415,7 @@ int gcc_modet::doit()
 
   // model validation
   compiler.validate_goto_model = cmdline.isset("validate-goto-model");
+  compiler.compress_goto_binaries = cmdline.isset("compress-goto-binaries");
 
   // determine actions to be undertaken
   if(cmdline.isset('S'))
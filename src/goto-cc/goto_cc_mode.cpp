@@ -67,6 +67,21 @@ void goto_cc_modet::help()
   " --print-rejected-preprocessed-source file\n"
   "                             copy failing (preprocessed) source to file\n"
   " --object-bits               number of bits used for object addresses\n"
+  " --compress-goto-binaries    write goto binaries compressed with deflate\n"
+  " --jobs n                    parse and type check up to n source files\n"
+  "                             in parallel\n"
+  " --object-cache dir          keep the type checked source files in dir\n"
+  "                             and reuse them when their preprocessed text\n"
+  "                             has not changed\n"
+  " --precompiled-headers dir   keep the type checked headers that source\n"
+  "                             files start with in dir and reuse them for\n"
+  "                             source files that start with the same\n"
+  "                             headers\n"
+  " --drop-unused-functions     drop the functions and variables that cannot\n"
+  "                             be reached from the entry point, main or a\n"
+  "                             function given with --keep-function when\n"
+  "                             linking\n"
+  " --keep-function f           keep function f with --drop-unused-functions\n"
   "\n";
   // clang-format on
 }
@@ -21,7 +21,15 @@ const char *goto_ld_options_with_argument[]=
   "--verbosity",
   "--native-compiler",
   "--native-linker",
+  "--keep-function",
+  nullptr
+};
+
+const char *goto_ld_options_without_argument[]=
+{
   "--validate-goto-model",
+  "--compress-goto-binaries",
+  "--drop-unused-functions",
   nullptr
 };
 
@@ -276,6 +284,17 @@ bool ld_cmdlinet::parse(int argc, const char **argv)
 
     bool found=false;
 
+    for(const char **o=goto_ld_options_without_argument;
+        *o!=nullptr && !found;
+        ++o)
+    {
+      if(argv_i==*o)
+      {
+        found=true;
+        set(*o);
+      }
+    }
+
     for(const char **o=goto_ld_options_with_argument;
         *o!=nullptr && !found;
         ++o)
@@ -83,6 +83,7 @@ int ld_modet::doit()
 
   // model validation
   compiler.validate_goto_model = cmdline.isset("validate-goto-model");
+  compiler.compress_goto_binaries = cmdline.isset("compress-goto-binaries");
 
   // get configuration
   config.set(cmdline);
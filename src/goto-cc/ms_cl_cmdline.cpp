@@ -45,6 +45,7 @@ const char *non_ms_cl_options[]=
   "--verbosity",
   "--function",
   "--validate-goto-model",
+  "--compress-goto-binaries",
   "--export-file-local-symbols",
   "--mangle-suffix",
   nullptr
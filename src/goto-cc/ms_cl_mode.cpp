@@ -67,6 +67,7 @@ int ms_cl_modet::doit()
 
   // model validation
   compiler.validate_goto_model = cmdline.isset("validate-goto-model");
+  compiler.compress_goto_binaries = cmdline.isset("compress-goto-binaries");
 
   // get configuration
   config.set(cmdline);
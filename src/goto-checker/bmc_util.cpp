@@ -320,19 +320,54 @@ void output_coverage_report(
   }
 }
 
+void output_symex_profile(
+  const std::string &profile_out,
+  const symex_bmct &symex,
+  ui_message_handlert &ui_message_handler)
+{
+  if(profile_out.empty() || symex.get_profile() == nullptr)
+    return;
+
+  messaget log(ui_message_handler);
+  if(symex.get_profile()->output(profile_out))
+  {
+    log.error() << "Failed to write symex profile to '" << profile_out << "'"
+                << messaget::eom;
+  }
+  else
+  {
+    log.status() << "Wrote symex profile to '" << profile_out << "'"
+                 << messaget::eom;
+  }
+}
+
 void postprocess_equation(
   symex_bmct &symex,
   symex_target_equationt &equation,
   const optionst &options,
   const namespacet &ns,
   ui_message_handlert &ui_message_handler)
+{
+  std::unique_ptr<memory_model_baset> memory_model;
+  postprocess_equation(
+    symex, equation, options, ns, ui_message_handler, memory_model, false);
+}
+
+void postprocess_equation(
+  symex_bmct &symex,
+  symex_target_equationt &equation,
+  const optionst &options,
+  const namespacet &ns,
+  ui_message_handlert &ui_message_handler,
+  std::unique_ptr<memory_model_baset> &memory_model,
+  bool lazy_memory_model)
 {
   const auto postprocess_equation_start = std::chrono::steady_clock::now();
   // add a partial ordering, if required
   if(equation.has_threads())
   {
-    std::unique_ptr<memory_model_baset> memory_model =
-      get_memory_model(options, ns);
+    memory_model = get_memory_model(options, ns);
+    memory_model->set_lazy_constraints(lazy_memory_model);
     (*memory_model)(equation, ui_message_handler);
   }
 
@@ -385,7 +420,8 @@ void run_property_decider(
   goto_symex_property_decidert &property_decider,
   ui_message_handlert &ui_message_handler,
   std::chrono::duration<double> solver_runtime,
-  bool set_pass)
+  bool set_pass,
+  memory_model_baset *memory_model)
 {
   auto solver_start = std::chrono::steady_clock::now();
 
@@ -404,6 +440,15 @@ void run_property_decider(
 
   decision_proceduret::resultt dec_result = property_decider.solve();
 
+  // add deferred partial order constraints that the model violates
+  while(memory_model != nullptr &&
+        dec_result == decision_proceduret::resultt::D_SATISFIABLE &&
+        memory_model->refine(
+          property_decider.get_decision_procedure(), ui_message_handler))
+  {
+    dec_result = property_decider.solve();
+  }
+
   auto const sat_solver_stop = std::chrono::steady_clock::now();
   std::chrono::duration<double> sat_solver_runtime =
     std::chrono::duration<double>(sat_solver_stop - sat_solver_start);
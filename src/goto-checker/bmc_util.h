@@ -93,6 +93,20 @@ void postprocess_equation(
   const namespacet &ns,
   ui_message_handlert &ui_message_handler);
 
+/// Post process the equation as above, but keep the memory model used to add
+/// partial order constraints.
+/// \param [out] memory_model: the memory model, if the equation has threads
+/// \param lazy_memory_model: whether the memory model should defer
+///   constraints, see \ref memory_model_baset::set_lazy_constraints
+void postprocess_equation(
+  symex_bmct &symex,
+  symex_target_equationt &equation,
+  const optionst &options,
+  const namespacet &ns,
+  ui_message_handlert &ui_message_handler,
+  std::unique_ptr<memory_model_baset> &memory_model,
+  bool lazy_memory_model);
+
 /// Output a coverage report as generated by \ref symex_coveraget
 /// if \p cov_out is non-empty.
 /// \param cov_out: file to write the report to; no report is generated
@@ -106,6 +120,17 @@ void output_coverage_report(
   const symex_bmct &symex,
   ui_message_handlert &ui_message_handler);
 
+/// Output the profile recorded by \ref symex_profilert if \p profile_out is
+/// non-empty.
+/// \param profile_out: file to write the profile to; no profile is written
+///   if this is empty
+/// \param symex: symbolic execution run to report the profile for
+/// \param ui_message_handler: status/warning message handler
+void output_symex_profile(
+  const std::string &profile_out,
+  const symex_bmct &symex,
+  ui_message_handlert &ui_message_handler);
+
 /// Sets property status to PASS for properties whose
 /// conditions are constant true in the \p equation.
 /// \param [in,out] properties: The status is updated in this data structure
@@ -162,13 +187,18 @@ std::chrono::duration<double> prepare_property_decider(
 /// \param solver_runtime: The solver runtime will be added and output
 /// \param set_pass: If true then update UNKNOWN properties to PASS
 ///   if the solver returns UNSATISFIABLE
+/// \param memory_model: If not null, the memory model that deferred some of
+///   its constraints; these are added as required by satisfying assignments
+///   until the solver either returns UNSATISFIABLE or finds an assignment
+///   consistent with the memory model
 void run_property_decider(
   incremental_goto_checkert::resultt &result,
   propertiest &properties,
   goto_symex_property_decidert &property_decider,
   ui_message_handlert &ui_message_handler,
   std::chrono::duration<double> solver_runtime,
-  bool set_pass = true);
+  bool set_pass = true,
+  memory_model_baset *memory_model = nullptr);
 
 // clang-format off
 #define OPT_BMC \
@@ -188,6 +218,8 @@ void run_property_decider(
   "(depth):" \
   "(max-field-sensitivity-array-size):" \
   "(no-array-field-sensitivity)" \
+  "(sparse-array-field-sensitivity)" \
+  "(symex-profile):" \
   "(graphml-witness):" \
   "(symex-complexity-limit):" \
   "(symex-complexity-failed-child-loops-limit):" \
@@ -217,6 +249,14 @@ void run_property_decider(
   "this is\n" \
   "                              equivalent to setting the maximum field \n" \
   "                              sensitivity size for arrays to 0\n" \
+  " --sparse-array-field-sensitivity\n" \
+  "                              apply field sensitivity to those cells of\n" \
+  "                              larger arrays that are accessed at constant\n" \
+  "                              indices\n" \
+  " --symex-profile file         write the time spent in symbolic execution\n" \
+  "                              per call stack to file, as JSON if file\n" \
+  "                              ends in .json and as folded stacks for\n" \
+  "                              flame graphs otherwise\n" \
   HELP_UNWINDSET \
   " --incremental-loop L         check properties after each unwinding\n" \
   "                              of loop L\n" \
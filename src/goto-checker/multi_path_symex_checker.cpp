@@ -31,6 +31,7 @@ multi_path_symex_checkert::multi_path_symex_checkert(
     equation_generated(false),
     property_decider(options, ui_message_handler, equation, ns)
 {
+  lazy_memory_model = options.get_bool_option("refine-memory-model");
 }
 
 // generates a complexity graph associated with the given query,
@@ -163,6 +164,9 @@ operator()(propertiest &properties)
       symex,
       ui_message_handler);
 
+    output_symex_profile(
+      options.get_option("symex-profile"), symex, ui_message_handler);
+
     update_properties(properties, result.updated_properties);
 
     // Have we got anything to check? Otherwise we return DONE.
@@ -196,7 +200,13 @@ void multi_path_symex_checkert::run_property_decider(
   std::chrono::duration<double> solver_runtime)
 {
   ::run_property_decider(
-    result, properties, property_decider, ui_message_handler, solver_runtime);
+    result,
+    properties,
+    property_decider,
+    ui_message_handler,
+    solver_runtime,
+    true,
+    memory_model.get());
 }
 
 goto_tracet multi_path_symex_checkert::build_full_trace() const
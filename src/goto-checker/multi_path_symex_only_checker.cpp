@@ -11,8 +11,10 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include "multi_path_symex_only_checker.h"
 
+#include <util/exception_utils.h>
 #include <util/ui_message.h>
 
+#include <goto-symex/equation_binary.h>
 #include <goto-symex/show_program.h>
 #include <goto-symex/show_vcc.h>
 
@@ -36,7 +38,8 @@ multi_path_symex_only_checkert::multi_path_symex_only_checkert(
       options,
       path_storage,
       guard_manager,
-      unwindset)
+      unwindset),
+    lazy_memory_model(false)
 {
   setup_symex(symex, ns, options, ui_message_handler);
 }
@@ -52,6 +55,9 @@ operator()(propertiest &properties)
     symex,
     ui_message_handler);
 
+  output_symex_profile(
+    options.get_option("symex-profile"), symex, ui_message_handler);
+
   if(options.get_bool_option("show-vcc"))
   {
     show_vcc(options, ui_message_handler, equation);
@@ -74,6 +80,16 @@ operator()(propertiest &properties)
 
 void multi_path_symex_only_checkert::generate_equation()
 {
+  const std::string read_equation = options.get_option("read-equation");
+  if(!read_equation.empty())
+  {
+    log.status() << "Reading SSA equation from '" << read_equation << "'"
+                 << messaget::eom;
+    read_equation_binary(
+      read_equation, equation, symex_symbol_table, goto_model);
+    return;
+  }
+
   const auto symex_start = std::chrono::steady_clock::now();
 
   symex.symex_from_entry_point_of(
@@ -85,7 +101,31 @@ void multi_path_symex_only_checkert::generate_equation()
   log.status() << "Runtime Symex: " << symex_runtime.count() << "s"
                << messaget::eom;
 
-  postprocess_equation(symex, equation, options, ns, ui_message_handler);
+  postprocess_equation(
+    symex,
+    equation,
+    options,
+    ns,
+    ui_message_handler,
+    memory_model,
+    lazy_memory_model);
+
+  const std::string write_equation = options.get_option("write-equation");
+  if(!write_equation.empty())
+  {
+    log.status() << "Writing SSA equation to '" << write_equation << "'"
+                 << messaget::eom;
+    if(write_equation_binary(
+         write_equation,
+         equation,
+         symex_symbol_table,
+         goto_model,
+         ui_message_handler))
+    {
+      throw system_exceptiont(
+        "failed to write SSA equation to '" + write_equation + "'");
+    }
+  }
 }
 
 void multi_path_symex_only_checkert::update_properties(
@@ -14,6 +14,7 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include "incremental_goto_checker.h"
 
+#include <goto-symex/memory_model.h>
 #include <goto-symex/path_storage.h>
 
 #include <goto-instrument/unwindset.h>
@@ -40,6 +41,12 @@ class multi_path_symex_only_checkert : public incremental_goto_checkert
   unwindsett unwindset;
   symex_bmct symex;
 
+  /// The memory model used for concurrent programs, if any
+  std::unique_ptr<memory_model_baset> memory_model;
+  /// Whether \ref memory_model may defer constraints, which requires the
+  /// solver to be run via \ref run_property_decider
+  bool lazy_memory_model;
+
   /// Generates the equation by running goto-symex
   virtual void generate_equation();
 
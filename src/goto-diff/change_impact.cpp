@@ -17,6 +17,7 @@ Date: April 2016
 
 #include <goto-programs/goto_model.h>
 
+#include <analyses/call_graph_helpers.h>
 #include <analyses/dependence_graph.h>
 
 #include "unified_diff.h"
@@ -211,6 +212,12 @@ class change_impactt
 
   void operator()();
 
+  /// Compute the change impact without producing any output
+  void compute();
+
+  /// \return the ids of the properties of the new model that may be impacted
+  std::set<irep_idt> impacted_properties() const;
+
 protected:
   impact_modet impact_mode;
   bool compact_output;
@@ -488,6 +495,50 @@ void change_impactt::propogate_dep_back(
 }
 
 void change_impactt::operator()()
+{
+  compute();
+
+  goto_functions_change_impactt::const_iterator oc_it=
+    old_change_impact.begin();
+  for(goto_functions_change_impactt::const_iterator
+      nc_it=new_change_impact.begin();
+      nc_it!=new_change_impact.end();
+      ++nc_it)
+  {
+    for( ;
+        oc_it!=old_change_impact.end() && oc_it->first<nc_it->first;
+        ++oc_it)
+      output_change_impact(
+        oc_it->first,
+        oc_it->second,
+        old_goto_functions,
+        ns_old);
+
+    if(oc_it==old_change_impact.end() || nc_it->first<oc_it->first)
+      output_change_impact(
+        nc_it->first,
+        nc_it->second,
+        new_goto_functions,
+        ns_new);
+    else
+    {
+      assert(oc_it->first==nc_it->first);
+
+      output_change_impact(
+        nc_it->first,
+        oc_it->second,
+        old_goto_functions,
+        ns_old,
+        nc_it->second,
+        new_goto_functions,
+        ns_new);
+
+      ++oc_it;
+    }
+  }
+}
+
+void change_impactt::compute()
 {
   // sorted iteration over intersection(old functions, new functions)
   typedef std::map<irep_idt,
@@ -524,45 +575,112 @@ void change_impactt::operator()()
       ++ito;
     }
   }
+}
 
-  goto_functions_change_impactt::const_iterator oc_it=
-    old_change_impact.begin();
-  for(goto_functions_change_impactt::const_iterator
-      nc_it=new_change_impact.begin();
-      nc_it!=new_change_impact.end();
-      ++nc_it)
+static void insert_properties(
+  const goto_programt &goto_program,
+  std::set<irep_idt> &properties)
+{
+  for(const auto &instruction : goto_program.instructions)
   {
-    for( ;
-        oc_it!=old_change_impact.end() && oc_it->first<nc_it->first;
-        ++oc_it)
-      output_change_impact(
-        oc_it->first,
-        oc_it->second,
-        old_goto_functions,
-        ns_old);
+    if(instruction.is_assert())
+      properties.insert(instruction.source_location().get_property_id());
+  }
+}
 
-    if(oc_it==old_change_impact.end() || nc_it->first<oc_it->first)
-      output_change_impact(
-        nc_it->first,
-        nc_it->second,
-        new_goto_functions,
-        ns_new);
-    else
+std::set<irep_idt> change_impactt::impacted_properties() const
+{
+  std::set<irep_idt> result;
+
+  // Functions that were added or syntactically changed; their callees may now
+  // be called in different contexts.
+  std::set<irep_idt> changed_functions;
+  bool assumption_deleted = false;
+
+  for(const auto &function_impact : old_change_impact)
+  {
+    for(const auto &instruction_impact : function_impact.second)
     {
-      assert(oc_it->first==nc_it->first);
+      if(instruction_impact.second & DELETED)
+      {
+        changed_functions.insert(function_impact.first);
+        // assertions are assumed to hold once they have been checked
+        if(
+          instruction_impact.first->is_assume() ||
+          instruction_impact.first->is_assert())
+        {
+          assumption_deleted = true;
+        }
+      }
 
-      output_change_impact(
-        nc_it->first,
-        oc_it->second,
-        old_goto_functions,
-        ns_old,
-        nc_it->second,
-        new_goto_functions,
-        ns_new);
+      if(
+        instruction_impact.second != SAME &&
+        instruction_impact.first->is_assert())
+      {
+        result.insert(
+          instruction_impact.first->source_location().get_property_id());
+      }
+    }
+  }
 
-      ++oc_it;
+  for(const auto &function_impact : new_change_impact)
+  {
+    for(const auto &instruction_impact : function_impact.second)
+    {
+      if(instruction_impact.second & NEW)
+        changed_functions.insert(function_impact.first);
+
+      if(
+        instruction_impact.second != SAME &&
+        instruction_impact.first->is_assert())
+      {
+        result.insert(
+          instruction_impact.first->source_location().get_property_id());
+      }
     }
   }
+
+  // Removing an assumption may make any property fail
+  if(assumption_deleted)
+  {
+    for(const auto &gf_entry : new_goto_functions.function_map)
+      insert_properties(gf_entry.second.body, result);
+    return result;
+  }
+
+  for(const auto &gf_entry : new_goto_functions.function_map)
+  {
+    if(old_goto_functions.function_map.count(gf_entry.first) == 0)
+      changed_functions.insert(gf_entry.first);
+  }
+
+  if(changed_functions.empty())
+    return result;
+
+  const call_grapht::directed_grapht call_graph =
+    call_grapht(new_goto_functions).get_directed_graph();
+
+  std::set<irep_idt> impacted_functions;
+  for(const auto &function_id : changed_functions)
+  {
+    if(call_graph.get_node_index(function_id).has_value())
+    {
+      const std::set<irep_idt> reachable =
+        get_reachable_functions(call_graph, function_id);
+      impacted_functions.insert(reachable.begin(), reachable.end());
+    }
+    else
+      impacted_functions.insert(function_id);
+  }
+
+  for(const auto &function_id : impacted_functions)
+  {
+    const auto f_it = new_goto_functions.function_map.find(function_id);
+    if(f_it != new_goto_functions.function_map.end())
+      insert_properties(f_it->second.body, result);
+  }
+
+  return result;
 }
 
 void change_impactt::output_change_impact(
@@ -761,3 +879,12 @@ void change_impact(
   change_impactt c(model_old, model_new, impact_mode, compact_output);
   c();
 }
+
+std::set<irep_idt> impacted_properties(
+  const goto_modelt &model_old,
+  const goto_modelt &model_new)
+{
+  change_impactt c(model_old, model_new, impact_modet::FORWARD, true);
+  c.compute();
+  return c.impacted_properties();
+}
@@ -14,6 +14,10 @@ Date: April 2016
 #ifndef CPROVER_GOTO_DIFF_CHANGE_IMPACT_H
 #define CPROVER_GOTO_DIFF_CHANGE_IMPACT_H
 
+#include <util/irep.h>
+
+#include <set>
+
 class goto_modelt;
 enum class impact_modet { FORWARD, BACKWARD, BOTH };
 
@@ -23,4 +27,15 @@ void change_impact(
   impact_modet impact_mode,
   bool compact_output);
 
+/// Determine the properties of \p model_new whose verification result may
+/// differ from the one in \p model_old. These are the assertions that are
+/// syntactically new or forward dependent on a change, as well as all
+/// assertions in functions that were added or changed and in the functions
+/// they (transitively) call. If an assumption or assertion was removed, all
+/// properties are impacted.
+/// \return the property ids of the impacted assertions of \p model_new
+std::set<irep_idt> impacted_properties(
+  const goto_modelt &model_old,
+  const goto_modelt &model_new);
+
 #endif // CPROVER_GOTO_DIFF_CHANGE_IMPACT_H
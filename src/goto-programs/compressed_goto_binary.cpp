@@ -0,0 +1,147 @@
+/*******************************************************************\
+
+Module: Compressed Goto Binaries
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Compressed Goto Binaries
+
+#include "compressed_goto_binary.h"
+
+#include <miniz/miniz.h>
+
+#include <istream>
+#include <ostream>
+
+/// The size of the buffers of the stream buffers
+static const std::size_t buffer_size = 1 << 16;
+
+deflate_streambuft::deflate_streambuft(std::ostream &out)
+  : out(out), stream(new mz_stream()), input(buffer_size), output(buffer_size)
+{
+  setp(input.data(), input.data() + input.size());
+  error = mz_deflateInit(stream.get(), MZ_DEFAULT_LEVEL) != MZ_OK;
+}
+
+deflate_streambuft::~deflate_streambuft()
+{
+  if(!finished)
+    mz_deflateEnd(stream.get());
+}
+
+bool deflate_streambuft::compress_input(int flush)
+{
+  stream->next_in = reinterpret_cast<const unsigned char *>(pbase());
+  stream->avail_in = static_cast<unsigned int>(pptr() - pbase());
+
+  int status;
+  do
+  {
+    stream->next_out = reinterpret_cast<unsigned char *>(output.data());
+    stream->avail_out = static_cast<unsigned int>(output.size());
+
+    status = mz_deflate(stream.get(), flush);
+    if(status != MZ_OK && status != MZ_STREAM_END)
+      return true;
+
+    out.write(output.data(), output.size() - stream->avail_out);
+    if(!out)
+      return true;
+  } while(stream->avail_out == 0 ||
+          (flush == MZ_FINISH && status != MZ_STREAM_END));
+
+  setp(input.data(), input.data() + input.size());
+  return false;
+}
+
+deflate_streambuft::int_type deflate_streambuft::overflow(int_type ch)
+{
+  if(error || finished)
+    return traits_type::eof();
+
+  if(compress_input(MZ_NO_FLUSH))
+  {
+    error = true;
+    return traits_type::eof();
+  }
+
+  if(!traits_type::eq_int_type(ch, traits_type::eof()))
+  {
+    *pptr() = traits_type::to_char_type(ch);
+    pbump(1);
+  }
+
+  return traits_type::not_eof(ch);
+}
+
+bool deflate_streambuft::finish()
+{
+  if(finished)
+    return error;
+
+  if(!error && compress_input(MZ_FINISH))
+    error = true;
+
+  mz_deflateEnd(stream.get());
+  finished = true;
+  setp(nullptr, nullptr);
+
+  return error;
+}
+
+inflate_streambuft::inflate_streambuft(std::istream &in)
+  : in(in), stream(new mz_stream()), input(buffer_size), output(buffer_size)
+{
+  setg(output.data(), output.data(), output.data());
+  error = mz_inflateInit(stream.get()) != MZ_OK;
+}
+
+inflate_streambuft::~inflate_streambuft()
+{
+  mz_inflateEnd(stream.get());
+}
+
+inflate_streambuft::int_type inflate_streambuft::underflow()
+{
+  if(gptr() < egptr())
+    return traits_type::to_int_type(*gptr());
+
+  while(!error && !ended)
+  {
+    bool end_of_input = false;
+    if(stream->avail_in == 0)
+    {
+      in.read(input.data(), input.size());
+      stream->next_in = reinterpret_cast<const unsigned char *>(input.data());
+      stream->avail_in = static_cast<unsigned int>(in.gcount());
+      end_of_input = stream->avail_in == 0;
+    }
+
+    stream->next_out = reinterpret_cast<unsigned char *>(output.data());
+    stream->avail_out = static_cast<unsigned int>(output.size());
+
+    const int status = mz_inflate(stream.get(), MZ_NO_FLUSH);
+    const std::size_t produced = output.size() - stream->avail_out;
+
+    if(status == MZ_STREAM_END)
+      ended = true;
+    else if(
+      (status != MZ_OK && status != MZ_BUF_ERROR) ||
+      (end_of_input && produced == 0))
+    {
+      // corrupt, or truncated
+      error = true;
+    }
+
+    if(produced != 0)
+    {
+      setg(output.data(), output.data(), output.data() + produced);
+      return traits_type::to_int_type(*gptr());
+    }
+  }
+
+  return traits_type::eof();
+}
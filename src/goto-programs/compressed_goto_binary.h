@@ -0,0 +1,84 @@
+/*******************************************************************\
+
+Module: Compressed Goto Binaries
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Compressed Goto Binaries
+
+#ifndef CPROVER_GOTO_PROGRAMS_COMPRESSED_GOTO_BINARY_H
+#define CPROVER_GOTO_PROGRAMS_COMPRESSED_GOTO_BINARY_H
+
+#include <iosfwd>
+#include <memory>
+#include <streambuf>
+#include <vector>
+
+// A compressed goto binary is marked with 0x7f GBZ, which is followed by the
+// zlib stream of a goto binary, including its own header.
+
+struct mz_stream_s;
+
+/// Compresses everything that is written to it with deflate, and writes the
+/// result to another stream as a zlib stream. Data is compressed in chunks of
+/// the size of the buffer, such that the uncompressed data is never held in
+/// memory as a whole.
+class deflate_streambuft : public std::streambuf
+{
+public:
+  explicit deflate_streambuft(std::ostream &out);
+  ~deflate_streambuft() override;
+
+  /// Compress the data that is still buffered and end the zlib stream.
+  /// Nothing can be written afterwards.
+  /// \return true on error, false otherwise
+  bool finish();
+
+protected:
+  int_type overflow(int_type ch) override;
+
+private:
+  std::ostream &out;
+  std::unique_ptr<mz_stream_s> stream;
+  std::vector<char> input;
+  std::vector<char> output;
+  bool error = false;
+  bool finished = false;
+
+  /// Compress the buffered data, passing \p flush to deflate
+  /// \return true on error, false otherwise
+  bool compress_input(int flush);
+};
+
+/// Decompresses a zlib stream that is read from another stream. Data is read
+/// and decompressed in chunks of the size of the buffers, such that neither
+/// the compressed nor the uncompressed data is held in memory as a whole.
+/// The other stream may be read beyond the end of the zlib stream.
+class inflate_streambuft : public std::streambuf
+{
+public:
+  explicit inflate_streambuft(std::istream &in);
+  ~inflate_streambuft() override;
+
+  /// \return true if the zlib stream is corrupt or truncated
+  bool failed() const
+  {
+    return error;
+  }
+
+protected:
+  int_type underflow() override;
+
+private:
+  std::istream &in;
+  std::unique_ptr<mz_stream_s> stream;
+  std::vector<char> input;
+  std::vector<char> output;
+  bool error = false;
+  bool ended = false;
+};
+
+#endif // CPROVER_GOTO_PROGRAMS_COMPRESSED_GOTO_BINARY_H
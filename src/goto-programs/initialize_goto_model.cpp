@@ -14,6 +14,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <fstream>
 
 #include <util/config.h>
+#include <util/make_unique.h>
 #include <util/message.h>
 #include <util/options.h>
 
@@ -29,6 +30,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/exception_utils.h>
 
 #include "goto_convert_functions.h"
+#include "read_bin_goto_object.h"
 #include "read_goto_binary.h"
 
 /// Generate an entry point that calls a function with the given name, based on
@@ -207,7 +209,39 @@ goto_modelt initialize_goto_model(
   initialize_from_source_files(
     sources, options, language_files, goto_model.symbol_table, message_handler);
 
-  if(read_objects_and_link(binaries, goto_model, message_handler))
+  // Unused functions are dropped anyway, thus only the bodies of the
+  // functions that are reachable from the entry point need to be read.
+  std::unique_ptr<lazy_goto_binary_readert> lazy_reader;
+  if(
+    options.get_bool_option("drop-unused-functions") && sources.empty() &&
+    binaries.size() == 1 &&
+    lazy_goto_binary_readert::is_indexed(binaries.front()))
+  {
+    msg.status() << "Reading GOTO program from file " << binaries.front()
+                 << messaget::eom;
+
+    lazy_reader = util_make_unique<lazy_goto_binary_readert>(message_handler);
+    if(lazy_reader->read(
+         binaries.front(), goto_model.symbol_table, goto_model.goto_functions))
+    {
+      throw incorrect_goto_program_exceptiont{"failed to read goto model"};
+    }
+
+    // goto_convert would otherwise convert these from the symbol table
+    for(const auto &symbol_pair : goto_model.symbol_table.symbols)
+    {
+      const symbolt &symbol = symbol_pair.second;
+      if(
+        !symbol.is_type && symbol.type.id() == ID_code &&
+        symbol.value.is_not_nil() && !symbol.is_compiled())
+      {
+        lazy_reader->read_body(symbol.name, goto_model.goto_functions);
+      }
+    }
+
+    config.set_from_symbol_table(goto_model.symbol_table);
+  }
+  else if(read_objects_and_link(binaries, goto_model, message_handler))
     throw incorrect_goto_program_exceptiont{"failed to read/link goto model"};
 
   set_up_custom_entry_point(
@@ -230,6 +264,12 @@ goto_modelt initialize_goto_model(
     goto_model.goto_functions,
     message_handler);
 
+  if(lazy_reader)
+  {
+    lazy_reader->read_reachable_bodies(
+      goto_functionst::entry_point(), goto_model.goto_functions);
+  }
+
   if(options.is_set("validate-goto-model"))
   {
     goto_model_validation_optionst goto_model_validation_options{
@@ -111,11 +111,15 @@ optionalt<replace_symbolt::expr_mapt> link_goto_model(
   goto_modelt &&src,
   message_handlert &message_handler)
 {
+  // Only the weak symbols that src collides with matter, which are found
+  // without visiting every symbol of dest, as dest grows with every model
+  // that is linked into it.
   std::unordered_set<irep_idt> weak_symbols;
 
-  for(const auto &symbol_pair : dest.symbol_table.symbols)
+  for(const auto &symbol_pair : src.symbol_table.symbols)
   {
-    if(symbol_pair.second.is_weak)
+    const symbolt *dest_symbol = dest.symbol_table.lookup(symbol_pair.first);
+    if(dest_symbol != nullptr && dest_symbol->is_weak)
       weak_symbols.insert(symbol_pair.first);
   }
 
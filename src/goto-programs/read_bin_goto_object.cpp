@@ -13,17 +13,25 @@ Date: June 2006
 
 #include "read_bin_goto_object.h"
 
+#include <util/find_symbols.h>
 #include <util/message.h>
 #include <util/symbol_table.h>
 #include <util/irep_serialization.h>
 
+#ifdef _MSC_VER
+#  include <util/unicode.h>
+#endif
+
+#include "compressed_goto_binary.h"
 #include "goto_functions.h"
 #include "write_goto_binary.h"
 
-/// read goto binary format
-/// \par parameters: input stream, symbol_table, functions
-/// \return true on error, false otherwise
-static bool read_bin_goto_object(
+/// read the symbol table of a goto binary
+/// \param in: input stream
+/// \param symbol_table: the symbol table to add the symbols to
+/// \param functions: receives an empty function for each function symbol
+/// \param irepconverter: the converter of the symbol table
+static void read_symbol_table(
   std::istream &in,
   symbol_tablet &symbol_table,
   goto_functionst &functions,
@@ -78,91 +86,181 @@ static bool read_bin_goto_object(
 
     symbol_table.add(sym);
   }
+}
 
-  count=irepconverter.read_gb_word(in); // # of functions
+/// read the instructions of a function of a goto binary
+/// \param in: input stream
+/// \param f: the function to add the instructions to
+/// \param irepconverter: the converter of the function
+static void read_goto_function(
+  std::istream &in,
+  goto_functionst::goto_functiont &f,
+  irep_serializationt &irepconverter)
+{
+  typedef std::map<goto_programt::targett, std::list<unsigned> > target_mapt;
+  target_mapt target_map;
+  typedef std::map<unsigned, goto_programt::targett> rev_target_mapt;
+  rev_target_mapt rev_target_map;
 
-  for(std::size_t fct_index = 0; fct_index < count; ++fct_index)
+  bool hidden=false;
+
+  std::size_t ins_count = irepconverter.read_gb_word(in); // # of instructions
+  for(std::size_t ins_index = 0; ins_index < ins_count; ++ins_index)
   {
-    irep_idt fname=irepconverter.read_gb_string(in);
-    goto_functionst::goto_functiont &f = functions.function_map[fname];
+    goto_programt::targett itarget = f.body.add_instruction();
 
-    typedef std::map<goto_programt::targett, std::list<unsigned> > target_mapt;
-    target_mapt target_map;
-    typedef std::map<unsigned, goto_programt::targett> rev_target_mapt;
-    rev_target_mapt rev_target_map;
+    // take copies as references into irepconverter are not stable
+    codet code =
+      static_cast<const codet &>(irepconverter.reference_convert(in));
+    source_locationt source_location = static_cast<const source_locationt &>(
+      irepconverter.reference_convert(in));
+    goto_program_instruction_typet instruction_type =
+      (goto_program_instruction_typet)irepconverter.read_gb_word(in);
+    exprt guard =
+      static_cast<const exprt &>(irepconverter.reference_convert(in));
 
-    bool hidden=false;
+    goto_programt::instructiont instruction{
+      code, source_location, instruction_type, guard, {}};
 
-    std::size_t ins_count = irepconverter.read_gb_word(in); // # of instructions
-    for(std::size_t ins_index = 0; ins_index < ins_count; ++ins_index)
-    {
-      goto_programt::targett itarget = f.body.add_instruction();
-
-      // take copies as references into irepconverter are not stable
-      codet code =
-        static_cast<const codet &>(irepconverter.reference_convert(in));
-      source_locationt source_location = static_cast<const source_locationt &>(
-        irepconverter.reference_convert(in));
-      goto_program_instruction_typet instruction_type =
-        (goto_program_instruction_typet)irepconverter.read_gb_word(in);
-      exprt guard =
-        static_cast<const exprt &>(irepconverter.reference_convert(in));
-
-      goto_programt::instructiont instruction{
-        code, source_location, instruction_type, guard, {}};
-
-      instruction.target_number = irepconverter.read_gb_word(in);
-      if(instruction.is_target() &&
-         rev_target_map.insert(
-           rev_target_map.end(),
-           std::make_pair(instruction.target_number, itarget))->second!=itarget)
-        UNREACHABLE;
-
-      std::size_t t_count = irepconverter.read_gb_word(in); // # of targets
-      for(std::size_t i=0; i<t_count; i++)
-        // just save the target numbers
-        target_map[itarget].push_back(irepconverter.read_gb_word(in));
-
-      std::size_t l_count = irepconverter.read_gb_word(in); // # of labels
-
-      for(std::size_t i=0; i<l_count; i++)
-      {
-        irep_idt label=irepconverter.read_string_ref(in);
-        instruction.labels.push_back(label);
-        if(label == CPROVER_PREFIX "HIDE")
-          hidden=true;
-        // The above info is also held in the goto_functiont object, and could
-        // be stored in the binary.
-      }
+    instruction.target_number = irepconverter.read_gb_word(in);
+    if(instruction.is_target() &&
+       rev_target_map.insert(
+         rev_target_map.end(),
+         std::make_pair(instruction.target_number, itarget))->second!=itarget)
+      UNREACHABLE;
 
-      itarget->swap(instruction);
-    }
+    std::size_t t_count = irepconverter.read_gb_word(in); // # of targets
+    for(std::size_t i=0; i<t_count; i++)
+      // just save the target numbers
+      target_map[itarget].push_back(irepconverter.read_gb_word(in));
 
-    // Resolve targets
-    for(target_mapt::iterator tit = target_map.begin();
-        tit!=target_map.end();
-        tit++)
+    std::size_t l_count = irepconverter.read_gb_word(in); // # of labels
+
+    for(std::size_t i=0; i<l_count; i++)
     {
-      goto_programt::targett ins = tit->first;
+      irep_idt label=irepconverter.read_string_ref(in);
+      instruction.labels.push_back(label);
+      if(label == CPROVER_PREFIX "HIDE")
+        hidden=true;
+      // The above info is also held in the goto_functiont object, and could
+      // be stored in the binary.
+    }
 
-      for(std::list<unsigned>::iterator nit = tit->second.begin();
-          nit!=tit->second.end();
-          nit++)
-      {
-        unsigned n=*nit;
-        rev_target_mapt::const_iterator entry=rev_target_map.find(n);
-        INVARIANT(
-          entry != rev_target_map.end(),
-          "something from the target map should also be in the reverse target "
-          "map");
-        ins->targets.push_back(entry->second);
-      }
+    itarget->swap(instruction);
+  }
+
+  // Resolve targets
+  for(target_mapt::iterator tit = target_map.begin();
+      tit!=target_map.end();
+      tit++)
+  {
+    goto_programt::targett ins = tit->first;
+
+    for(std::list<unsigned>::iterator nit = tit->second.begin();
+        nit!=tit->second.end();
+        nit++)
+    {
+      unsigned n=*nit;
+      rev_target_mapt::const_iterator entry=rev_target_map.find(n);
+      INVARIANT(
+        entry != rev_target_map.end(),
+        "something from the target map should also be in the reverse target "
+        "map");
+      ins->targets.push_back(entry->second);
     }
+  }
+
+  f.body.update();
+
+  if(hidden)
+    f.make_hidden();
+}
+
+/// read goto binary format of \ref GOTO_BINARY_UNINDEXED_VERSION
+/// \par parameters: input stream, symbol_table, functions
+/// \return true on error, false otherwise
+static bool read_unindexed_bin_goto_object(
+  std::istream &in,
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  irep_serializationt &irepconverter)
+{
+  read_symbol_table(in, symbol_table, functions, irepconverter);
 
-    f.body.update();
+  std::size_t count = irepconverter.read_gb_word(in); // # of functions
 
-    if(hidden)
-      f.make_hidden();
+  for(std::size_t fct_index = 0; fct_index < count; ++fct_index)
+  {
+    irep_idt fname=irepconverter.read_gb_string(in);
+    read_goto_function(in, functions.function_map[fname], irepconverter);
+  }
+
+  functions.compute_location_numbers();
+
+  return false;
+}
+
+/// The index of the functions of a goto binary, with the size in bytes of
+/// the section of each function, in the order of the sections
+typedef std::vector<std::pair<irep_idt, std::size_t>> function_indext;
+
+/// read the symbol table and the index of the functions of a goto binary
+/// \param in: input stream
+/// \param symbol_table: the symbol table to add the symbols to
+/// \param functions: receives an empty function for each function symbol
+/// \param irepconverter: the converter of the symbol table
+/// \param [out] shared_ireps: the number of ireps of the symbol table
+/// \param [out] shared_strings: the first reference of a string that is not
+///   in the symbol table
+/// \return the index of the functions
+static function_indext read_symbol_table_and_index(
+  std::istream &in,
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  irep_serializationt &irepconverter,
+  std::size_t &shared_ireps,
+  std::size_t &shared_strings)
+{
+  read_symbol_table(in, symbol_table, functions, irepconverter);
+
+  shared_ireps = irepconverter.read_gb_word(in);
+  shared_strings = irepconverter.read_gb_word(in);
+
+  function_indext index;
+  std::size_t count = irepconverter.read_gb_word(in); // # of functions
+  index.reserve(count);
+  for(std::size_t fct_index = 0; fct_index < count; ++fct_index)
+  {
+    irep_idt fname = irepconverter.read_gb_string(in);
+    index.emplace_back(fname, irepconverter.read_gb_word(in));
+  }
+
+  return index;
+}
+
+/// read goto binary format
+/// \par parameters: input stream, symbol_table, functions
+/// \return true on error, false otherwise
+static bool read_bin_goto_object(
+  std::istream &in,
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  irep_serializationt &irepconverter,
+  irep_serializationt::ireps_containert &shared_container)
+{
+  std::size_t shared_ireps, shared_strings;
+  const function_indext index = read_symbol_table_and_index(
+    in, symbol_table, functions, irepconverter, shared_ireps, shared_strings);
+
+  // the sections follow the index in the same order
+  for(const auto &entry : index)
+  {
+    irep_serializationt::ireps_containert function_container;
+    irep_serializationt function_converter(
+      function_container, shared_container, shared_ireps, shared_strings);
+
+    read_goto_function(
+      in, functions.function_map[entry.first], function_converter);
   }
 
   functions.compute_location_numbers();
@@ -199,6 +297,25 @@ bool read_bin_goto_object(
       {
         // OK!
       }
+      else if(hdr[0]==0x7f && hdr[1]=='G' && hdr[2]=='B' && hdr[3]=='Z')
+      {
+        // compressed, read the goto binary that it contains
+        inflate_streambuft inflater(in);
+        std::istream inflated(&inflater);
+
+        const bool error = read_bin_goto_object(
+          inflated, filename, symbol_table, functions, message_handler);
+
+        if(inflater.failed())
+        {
+          message.error() << "'" << filename
+                          << "' is a corrupt compressed goto-binary"
+                          << messaget::eom;
+          return true;
+        }
+
+        return error;
+      }
       else if(hdr[0]==0x7f && hdr[1]=='E' && hdr[2]=='L' && hdr[3]=='F')
       {
         if(!filename.empty())
@@ -226,16 +343,22 @@ bool read_bin_goto_object(
   {
     std::size_t version=irepconverter.read_gb_word(in);
 
-    if(version < GOTO_BINARY_VERSION)
+    if(version < GOTO_BINARY_UNINDEXED_VERSION)
     {
       message.error() <<
           "The input was compiled with an old version of "
           "goto-cc; please recompile" << messaget::eom;
       return true;
     }
+    else if(version == GOTO_BINARY_UNINDEXED_VERSION)
+    {
+      return read_unindexed_bin_goto_object(
+        in, symbol_table, functions, irepconverter);
+    }
     else if(version == GOTO_BINARY_VERSION)
     {
-      return read_bin_goto_object(in, symbol_table, functions, irepconverter);
+      return read_bin_goto_object(
+        in, symbol_table, functions, irepconverter, ic);
     }
     else
     {
@@ -248,3 +371,150 @@ bool read_bin_goto_object(
 
   return false;
 }
+
+/// Read the header of a goto binary that has an index of its functions
+/// \return true if \p in is not such a goto binary
+static bool read_indexed_header(std::istream &in)
+{
+  char hdr[4];
+  in.read(hdr, 4);
+  if(!in || hdr[0] != 0x7f || hdr[1] != 'G' || hdr[2] != 'B' || hdr[3] != 'F')
+    return true;
+
+  try
+  {
+    return irep_serializationt::read_gb_word(in) != GOTO_BINARY_VERSION;
+  }
+  catch(const deserialization_exceptiont &)
+  {
+    return true;
+  }
+}
+
+bool lazy_goto_binary_readert::is_indexed(const std::string &filename)
+{
+#ifdef _MSC_VER
+  std::ifstream in(widen(filename), std::ios::binary);
+#else
+  std::ifstream in(filename, std::ios::binary);
+#endif
+
+  return in && !read_indexed_header(in);
+}
+
+bool lazy_goto_binary_readert::read(
+  const std::string &filename,
+  symbol_tablet &symbol_table,
+  goto_functionst &goto_functions)
+{
+#ifdef _MSC_VER
+  in.open(widen(filename), std::ios::binary);
+#else
+  in.open(filename, std::ios::binary);
+#endif
+
+  if(!in)
+  {
+    log.error() << "Failed to open '" << filename << "'" << messaget::eom;
+    return true;
+  }
+
+  if(read_indexed_header(in))
+  {
+    log.error() << "'" << filename
+                << "' is not a goto binary with an index of its functions"
+                << messaget::eom;
+    return true;
+  }
+
+  try
+  {
+    const function_indext index = read_symbol_table_and_index(
+      in,
+      symbol_table,
+      goto_functions,
+      irepconverter,
+      shared_ireps,
+      shared_strings);
+
+    std::streamoff offset = in.tellg();
+    for(const auto &entry : index)
+    {
+      unread_sections.emplace(entry.first, offset);
+      offset += entry.second;
+    }
+  }
+  catch(const deserialization_exceptiont &e)
+  {
+    log.error() << "Failed to read '" << filename << "': " << e.what()
+                << messaget::eom;
+    return true;
+  }
+
+  return false;
+}
+
+void lazy_goto_binary_readert::read_body(
+  const irep_idt &function,
+  goto_functionst &goto_functions)
+{
+  const auto entry = unread_sections.find(function);
+  if(entry == unread_sections.end())
+    return;
+
+  const std::streamoff offset = entry->second;
+  unread_sections.erase(entry);
+
+  // e.g. the entry point may have been generated anew
+  goto_functionst::goto_functiont &f = goto_functions.function_map[function];
+  if(f.body_available())
+    return;
+
+  in.clear();
+  in.seekg(offset);
+
+  irep_serializationt::ireps_containert function_container;
+  irep_serializationt function_converter(
+    function_container, shared_container, shared_ireps, shared_strings);
+
+  read_goto_function(in, f, function_converter);
+  goto_functions.compute_location_numbers(f.body);
+}
+
+void lazy_goto_binary_readert::read_reachable_bodies(
+  const irep_idt &function,
+  goto_functionst &goto_functions)
+{
+  std::unordered_set<irep_idt> visited{function};
+  std::vector<irep_idt> pending{function};
+
+  while(!pending.empty())
+  {
+    const irep_idt current = pending.back();
+    pending.pop_back();
+
+    read_body(current, goto_functions);
+
+    const auto f_it = goto_functions.function_map.find(current);
+    if(f_it == goto_functions.function_map.end())
+      continue;
+
+    find_symbols_sett referenced;
+    for(const auto &instruction : f_it->second.body.instructions)
+    {
+      find_symbols(instruction.code(), referenced);
+      if(instruction.has_condition())
+        find_symbols(instruction.condition(), referenced);
+    }
+
+    for(const irep_idt &identifier : referenced)
+    {
+      if(
+        goto_functions.function_map.count(identifier) != 0 &&
+        visited.insert(identifier).second)
+      {
+        pending.push_back(identifier);
+      }
+    }
+  }
+}
@@ -14,12 +14,15 @@ Date: May 2007
 #ifndef CPROVER_GOTO_PROGRAMS_READ_BIN_GOTO_OBJECT_H
 #define CPROVER_GOTO_PROGRAMS_READ_BIN_GOTO_OBJECT_H
 
-#include <iosfwd>
+#include <util/irep_serialization.h>
+#include <util/message.h>
+
+#include <fstream>
 #include <string>
+#include <unordered_map>
 
 class symbol_tablet;
 class goto_functionst;
-class message_handlert;
 
 bool read_bin_goto_object(
   std::istream &in,
@@ -28,4 +31,64 @@ bool read_bin_goto_object(
   goto_functionst &goto_functions,
   message_handlert &message_handler);
 
+/// Reads a goto binary that has an index of its functions, i.e., one of
+/// version \ref GOTO_BINARY_VERSION, reading the body of a function only when
+/// it is asked for. The file is kept open, and the ireps and strings of the
+/// symbol table are kept in memory, as the bodies of the functions refer to
+/// them.
+class lazy_goto_binary_readert
+{
+public:
+  explicit lazy_goto_binary_readert(message_handlert &message_handler)
+    : log(message_handler), irepconverter(shared_container)
+  {
+  }
+
+  /// \return true if \p filename is a goto binary with an index of its
+  ///   functions, rather than an older goto binary or one that is embedded in
+  ///   another object file
+  static bool is_indexed(const std::string &filename);
+
+  /// Read the symbol table and the index of the functions of the goto binary
+  /// \p filename
+  /// \param filename: the file name of the goto binary
+  /// \param symbol_table: receives the symbols
+  /// \param goto_functions: receives a function without body for each
+  ///   function symbol
+  /// \return true on error, false otherwise
+  bool read(
+    const std::string &filename,
+    symbol_tablet &symbol_table,
+    goto_functionst &goto_functions);
+
+  /// \return true if \p function has a body that has not been read yet
+  bool has_unread_body(const irep_idt &function) const
+  {
+    return unread_sections.find(function) != unread_sections.end();
+  }
+
+  /// Read the body of \p function into \p goto_functions, unless it has no
+  /// body in the goto binary or already has a body in \p goto_functions
+  void read_body(const irep_idt &function, goto_functionst &goto_functions);
+
+  /// Read the bodies of \p function and of all the functions that these
+  /// refer to, transitively, including functions whose address is taken
+  void read_reachable_bodies(
+    const irep_idt &function,
+    goto_functionst &goto_functions);
+
+private:
+  messaget log;
+  std::ifstream in;
+
+  irep_serializationt::ireps_containert shared_container;
+  irep_serializationt irepconverter;
+  std::size_t shared_ireps = 0;
+  std::size_t shared_strings = 0;
+
+  /// The offset in the file of the section of each function whose body has
+  /// not been read yet
+  std::unordered_map<irep_idt, std::streamoff> unread_sections;
+};
+
 #endif // CPROVER_GOTO_PROGRAMS_READ_BIN_GOTO_OBJECT_H
@@ -89,7 +89,9 @@ static bool read_goto_binary(
 
   in.seekg(0);
 
-  if(hdr[0]==0x7f && hdr[1]=='G' && hdr[2]=='B' && hdr[3]=='F')
+  if(
+    hdr[0] == 0x7f && hdr[1] == 'G' && hdr[2] == 'B' &&
+    (hdr[3] == 'F' || hdr[3] == 'Z'))
   {
     return read_bin_goto_object(
       in, filename, symbol_table, goto_functions, message_handler);
@@ -202,16 +204,20 @@ bool is_goto_binary(
   if(!in)
     return false;
 
-  // We accept two forms:
+  // We accept these forms:
   // 1. goto binaries, marked with 0x7f GBF
-  // 2. ELF binaries, marked with 0x7f ELF
+  // 2. compressed goto binaries, marked with 0x7f GBZ
+  // 3. ELF binaries, marked with 0x7f ELF
+  // 4. Mach-O binaries
 
   char hdr[8];
   in.read(hdr, 8);
   if(!in)
     return false;
 
-  if(hdr[0]==0x7f && hdr[1]=='G' && hdr[2]=='B' && hdr[3]=='F')
+  if(
+    hdr[0] == 0x7f && hdr[1] == 'G' && hdr[2] == 'B' &&
+    (hdr[3] == 'F' || hdr[3] == 'Z'))
   {
     return true; // yes, this is a goto binary
   }
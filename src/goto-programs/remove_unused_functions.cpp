@@ -11,10 +11,15 @@ Author: CM Wintersteiger
 
 #include "remove_unused_functions.h"
 
+#include <util/cprover_prefix.h>
+#include <util/find_symbols.h>
 #include <util/message.h>
+#include <util/prefix.h>
 
 #include "goto_model.h"
 
+#include <unordered_set>
+
 void remove_unused_functions(
   goto_modelt &goto_model,
   message_handlert &message_handler)
@@ -86,3 +91,89 @@ void find_used_functions(
     }
   }
 }
+
+void remove_unreachable_functions(
+  goto_modelt &goto_model,
+  const std::set<irep_idt> &roots,
+  message_handlert &message_handler)
+{
+  const symbol_tablet &symbol_table = goto_model.symbol_table;
+  goto_functionst &functions = goto_model.goto_functions;
+
+  std::vector<irep_idt> pending(roots.begin(), roots.end());
+
+  // constructors are only called by an entry point, which may be created
+  // when the result is linked again
+  for(const auto &named_symbol : symbol_table.symbols)
+  {
+    const symbolt &symbol = named_symbol.second;
+    if(
+      has_prefix(id2string(symbol.name), CPROVER_PREFIX) ||
+      (symbol.type.id() == ID_code &&
+       to_code_type(symbol.type).return_type().id() == ID_constructor))
+    {
+      pending.push_back(symbol.name);
+    }
+  }
+
+  std::unordered_set<irep_idt> reachable;
+  while(!pending.empty())
+  {
+    const irep_idt identifier = pending.back();
+    pending.pop_back();
+
+    if(!reachable.insert(identifier).second)
+      continue;
+
+    find_symbols_sett found;
+
+    const auto f_it = functions.function_map.find(identifier);
+    if(f_it != functions.function_map.end())
+    {
+      for(const auto &instruction : f_it->second.body.instructions)
+      {
+        find_symbols(instruction.code(), found);
+        if(instruction.has_condition())
+          find_symbols(instruction.condition(), found);
+      }
+    }
+
+    const symbolt *symbol = symbol_table.lookup(identifier);
+    if(symbol != nullptr && symbol->type.id() != ID_code && !symbol->is_type)
+      find_symbols(symbol->value, found);
+
+    pending.insert(pending.end(), found.begin(), found.end());
+  }
+
+  std::vector<irep_idt> unreachable_functions;
+  for(const auto &entry : functions.function_map)
+  {
+    if(reachable.find(entry.first) == reachable.end())
+      unreachable_functions.push_back(entry.first);
+  }
+
+  std::vector<irep_idt> unreachable_symbols;
+  for(const auto &named_symbol : symbol_table.symbols)
+  {
+    const symbolt &symbol = named_symbol.second;
+    if(
+      (symbol.type.id() == ID_code || symbol.is_static_lifetime) &&
+      !symbol.is_type && !symbol.is_macro &&
+      reachable.find(symbol.name) == reachable.end())
+    {
+      unreachable_symbols.push_back(symbol.name);
+    }
+  }
+
+  messaget message(message_handler);
+  message.statistics() << "Dropping " << unreachable_functions.size()
+                       << " of " << functions.function_map.size()
+                       << " functions and " << unreachable_symbols.size()
+                       << " symbols that are unreachable" << messaget::eom;
+
+  for(const irep_idt &identifier : unreachable_functions)
+    functions.function_map.erase(identifier);
+
+  for(const irep_idt &identifier : unreachable_symbols)
+    goto_model.symbol_table.remove(identifier);
+}
@@ -33,4 +33,20 @@ void find_used_functions(
   goto_functionst &functions,
   std::set<irep_idt> &seen);
 
+/// Remove the functions and the variables of static lifetime that cannot be
+/// reached from \p roots, together with their symbols. A function or
+/// variable is reachable if a reachable function refers to it, whether by
+/// calling a function or otherwise, e.g. by taking its address, or if the
+/// initial value of a reachable variable does. The possible targets of
+/// function pointers are thus kept whether or not function pointers have
+/// been removed. Functions that are marked as constructors are roots as
+/// well, as are the symbols that are internal to CPROVER.
+/// \param goto_model: the model to remove functions from
+/// \param roots: the functions that are to be kept, such as the entry point
+/// \param message_handler: the message handler
+void remove_unreachable_functions(
+  goto_modelt &goto_model,
+  const std::set<irep_idt> &roots,
+  message_handlert &message_handler);
+
 #endif // CPROVER_GOTO_PROGRAMS_REMOVE_UNUSED_FUNCTIONS_H
@@ -12,6 +12,7 @@ Author: CM Wintersteiger
 #include "write_goto_binary.h"
 
 #include <fstream>
+#include <sstream>
 
 #include <util/exception_utils.h>
 #include <util/irep_serialization.h>
@@ -20,15 +21,14 @@ Author: CM Wintersteiger
 
 #include <goto-programs/goto_model.h>
 
-/// Writes a goto program to disc, using goto binary format
-bool write_goto_binary(
+#include "compressed_goto_binary.h"
+
+/// Writes the symbol table, using goto binary format
+static void write_symbol_table(
   std::ostream &out,
   const symbol_tablet &symbol_table,
-  const goto_functionst &goto_functions,
   irep_serializationt &irepconverter)
 {
-  // first write symbol table
-
   write_gb_word(out, symbol_table.symbols.size());
 
   for(const auto &symbol_pair : symbol_table.symbols)
@@ -71,6 +71,52 @@ bool write_goto_binary(
 
     write_gb_word(out, flags);
   }
+}
+
+/// Writes the instructions of a function, using goto binary format
+static void write_goto_function(
+  std::ostream &out,
+  const goto_functionst::goto_functiont &goto_function,
+  irep_serializationt &irepconverter)
+{
+  // # instructions
+  write_gb_word(out, goto_function.body.instructions.size());
+
+  for(const auto &instruction : goto_function.body.instructions)
+  {
+    irepconverter.reference_convert(instruction.code(), out);
+    irepconverter.reference_convert(instruction.source_location(), out);
+    write_gb_word(out, (long)instruction.type());
+
+    const auto condition =
+      instruction.has_condition() ? instruction.condition() : true_exprt();
+    irepconverter.reference_convert(condition, out);
+
+    write_gb_word(out, instruction.target_number);
+
+    write_gb_word(out, instruction.targets.size());
+
+    for(const auto &t_it : instruction.targets)
+      write_gb_word(out, t_it->target_number);
+
+    write_gb_word(out, instruction.labels.size());
+
+    for(const auto &l_it : instruction.labels)
+      irepconverter.write_string_ref(out, l_it);
+  }
+}
+
+/// Writes a goto program to disc, using the goto binary format of
+/// \ref GOTO_BINARY_UNINDEXED_VERSION
+static bool write_unindexed_goto_binary(
+  std::ostream &out,
+  const symbol_tablet &symbol_table,
+  const goto_functionst &goto_functions,
+  irep_serializationt &irepconverter)
+{
+  // first write symbol table
+
+  write_symbol_table(out, symbol_table, irepconverter);
 
   // now write functions, but only those with body
 
@@ -91,35 +137,65 @@ bool write_goto_binary(
       // instead they are saved in a custom binary format
 
       write_gb_string(out, id2string(fct.first)); // name
-      write_gb_word(out, fct.second.body.instructions.size()); // # instructions
+      write_goto_function(out, fct.second, irepconverter);
+    }
+  }
+
+  // irepconverter.output_map(f);
+  // irepconverter.output_string_map(f);
+
+  return false;
+}
 
-      for(const auto &instruction : fct.second.body.instructions)
-      {
-        irepconverter.reference_convert(instruction.code(), out);
-        irepconverter.reference_convert(instruction.source_location(), out);
-        write_gb_word(out, (long)instruction.type());
+/// Writes a goto program to disc, using goto binary format. Each function is
+/// written as a section of its own that only refers to the ireps and strings
+/// of the symbol table, such that it can be read without reading any other
+/// function. The sections are preceded by an index of their sizes.
+/// \param out: the stream to write to
+/// \param symbol_table: the symbol table to write
+/// \param goto_functions: the functions to write
+/// \param irepconverter: the converter for the symbol table
+/// \param shared_container: the container of \p irepconverter
+static bool write_goto_binary(
+  std::ostream &out,
+  const symbol_tablet &symbol_table,
+  const goto_functionst &goto_functions,
+  irep_serializationt &irepconverter,
+  irep_serializationt::ireps_containert &shared_container)
+{
+  write_symbol_table(out, symbol_table, irepconverter);
 
-        const auto condition =
-          instruction.has_condition() ? instruction.condition() : true_exprt();
-        irepconverter.reference_convert(condition, out);
+  const std::size_t shared_ireps = shared_container.ireps_on_write.size();
+  const std::size_t shared_strings = shared_container.string_map.size();
+  write_gb_word(out, shared_ireps);
+  write_gb_word(out, shared_strings);
 
-        write_gb_word(out, instruction.target_number);
+  std::vector<std::pair<irep_idt, std::string>> sections;
 
-        write_gb_word(out, instruction.targets.size());
+  for(const auto &fct : goto_functions.function_map)
+  {
+    if(!fct.second.body_available())
+      continue;
 
-        for(const auto &t_it : instruction.targets)
-          write_gb_word(out, t_it->target_number);
+    irep_serializationt::ireps_containert function_container;
+    irep_serializationt function_converter(
+      function_container, shared_container, shared_ireps, shared_strings);
 
-        write_gb_word(out, instruction.labels.size());
+    std::ostringstream section;
+    write_goto_function(section, fct.second, function_converter);
+    sections.emplace_back(fct.first, section.str());
+  }
 
-        for(const auto &l_it : instruction.labels)
-          irepconverter.write_string_ref(out, l_it);
-      }
-    }
+  // the index
+  write_gb_word(out, sections.size());
+  for(const auto &section : sections)
+  {
+    write_gb_string(out, id2string(section.first));
+    write_gb_word(out, section.second.size());
   }
 
-  // irepconverter.output_map(f);
-  // irepconverter.output_string_map(f);
+  for(const auto &section : sections)
+    out << section.second;
 
   return false;
 }
@@ -151,7 +227,7 @@ bool write_goto_binary(
   irep_serializationt::ireps_containert irepc;
   irep_serializationt irepconverter(irepc);
 
-  if(version < GOTO_BINARY_VERSION)
+  if(version < GOTO_BINARY_UNINDEXED_VERSION)
     throw invalid_command_line_argument_exceptiont(
       "version " + std::to_string(version) + " no longer supported",
       "supported version = " + std::to_string(GOTO_BINARY_VERSION));
@@ -159,8 +235,42 @@ bool write_goto_binary(
     throw invalid_command_line_argument_exceptiont(
       "unknown goto binary version " + std::to_string(version),
       "supported version = " + std::to_string(GOTO_BINARY_VERSION));
+  else if(version == GOTO_BINARY_UNINDEXED_VERSION)
+  {
+    return write_unindexed_goto_binary(
+      out, symbol_table, goto_functions, irepconverter);
+  }
   else
-    return write_goto_binary(out, symbol_table, goto_functions, irepconverter);
+  {
+    return write_goto_binary(
+      out, symbol_table, goto_functions, irepconverter, irepc);
+  }
+}
+
+bool write_compressed_goto_binary(
+  std::ostream &out,
+  const symbol_tablet &symbol_table,
+  const goto_functionst &goto_functions,
+  int version)
+{
+  out << char(0x7f) << "GBZ";
+
+  deflate_streambuft deflater(out);
+  std::ostream deflated(&deflater);
+
+  if(write_goto_binary(deflated, symbol_table, goto_functions, version))
+    return true;
+
+  return deflater.finish() || !out;
+}
+
+bool write_compressed_goto_binary(
+  std::ostream &out,
+  const goto_modelt &goto_model,
+  int version)
+{
+  return write_compressed_goto_binary(
+    out, goto_model.symbol_table, goto_model.goto_functions, version);
 }
 
 /// Writes a goto program to disc
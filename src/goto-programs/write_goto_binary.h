@@ -12,7 +12,11 @@ Author: CM Wintersteiger
 #ifndef CPROVER_GOTO_PROGRAMS_WRITE_GOTO_BINARY_H
 #define CPROVER_GOTO_PROGRAMS_WRITE_GOTO_BINARY_H
 
-#define GOTO_BINARY_VERSION 5
+#define GOTO_BINARY_VERSION 6
+
+/// The oldest version that is still read and written, which lacks the index
+/// of the functions that permits reading them on demand
+#define GOTO_BINARY_UNINDEXED_VERSION 5
 
 #include <iosfwd>
 #include <string>
@@ -38,4 +42,19 @@ bool write_goto_binary(
   const goto_modelt &,
   message_handlert &);
 
+/// Write a goto binary that is compressed with deflate, which
+/// \ref read_goto_binary recognises. The goto binary is compressed while it is
+/// written, without holding it in memory as a whole.
+/// \return true on error, false otherwise
+bool write_compressed_goto_binary(
+  std::ostream &out,
+  const symbol_tablet &,
+  const goto_functionst &,
+  int version = GOTO_BINARY_VERSION);
+
+bool write_compressed_goto_binary(
+  std::ostream &out,
+  const goto_modelt &,
+  int version = GOTO_BINARY_VERSION);
+
 #endif // CPROVER_GOTO_PROGRAMS_WRITE_GOTO_BINARY_H
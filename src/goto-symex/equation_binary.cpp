@@ -0,0 +1,421 @@
+/*******************************************************************\
+
+Module: Binary serialization of SSA equations
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Binary serialization of SSA equations
+
+#include "equation_binary.h"
+
+#include <fstream>
+#include <unordered_map>
+
+#include <util/exception_utils.h>
+#include <util/irep_serialization.h>
+#include <util/message.h>
+#include <util/narrow.h>
+#include <util/symbol_table.h>
+#include <util/unicode.h>
+
+#include <goto-programs/abstract_goto_model.h>
+
+#include "symex_target_equation.h"
+
+static void write_symbol(
+  std::ostream &out,
+  const symbolt &symbol,
+  irep_serializationt &irepconverter)
+{
+  irepconverter.reference_convert(symbol.type, out);
+  irepconverter.reference_convert(symbol.value, out);
+  irepconverter.reference_convert(symbol.location, out);
+
+  irepconverter.write_string_ref(out, symbol.name);
+  irepconverter.write_string_ref(out, symbol.module);
+  irepconverter.write_string_ref(out, symbol.base_name);
+  irepconverter.write_string_ref(out, symbol.mode);
+  irepconverter.write_string_ref(out, symbol.pretty_name);
+
+  unsigned flags = 0;
+  flags = (flags << 1) | static_cast<int>(symbol.is_weak);
+  flags = (flags << 1) | static_cast<int>(symbol.is_type);
+  flags = (flags << 1) | static_cast<int>(symbol.is_property);
+  flags = (flags << 1) | static_cast<int>(symbol.is_macro);
+  flags = (flags << 1) | static_cast<int>(symbol.is_exported);
+  flags = (flags << 1) | static_cast<int>(symbol.is_input);
+  flags = (flags << 1) | static_cast<int>(symbol.is_output);
+  flags = (flags << 1) | static_cast<int>(symbol.is_state_var);
+  flags = (flags << 1) | static_cast<int>(symbol.is_parameter);
+  flags = (flags << 1) | static_cast<int>(symbol.is_auxiliary);
+  flags = (flags << 1) | static_cast<int>(symbol.is_lvalue);
+  flags = (flags << 1) | static_cast<int>(symbol.is_static_lifetime);
+  flags = (flags << 1) | static_cast<int>(symbol.is_thread_local);
+  flags = (flags << 1) | static_cast<int>(symbol.is_file_local);
+  flags = (flags << 1) | static_cast<int>(symbol.is_extern);
+  flags = (flags << 1) | static_cast<int>(symbol.is_volatile);
+
+  write_gb_word(out, flags);
+}
+
+static symbolt read_symbol(std::istream &in, irep_serializationt &irepconverter)
+{
+  symbolt symbol;
+
+  symbol.type = static_cast<const typet &>(irepconverter.reference_convert(in));
+  symbol.value =
+    static_cast<const exprt &>(irepconverter.reference_convert(in));
+  symbol.location =
+    static_cast<const source_locationt &>(irepconverter.reference_convert(in));
+
+  symbol.name = irepconverter.read_string_ref(in);
+  symbol.module = irepconverter.read_string_ref(in);
+  symbol.base_name = irepconverter.read_string_ref(in);
+  symbol.mode = irepconverter.read_string_ref(in);
+  symbol.pretty_name = irepconverter.read_string_ref(in);
+
+  const std::size_t flags = irepconverter.read_gb_word(in);
+
+  symbol.is_weak = (flags & (1 << 15)) != 0;
+  symbol.is_type = (flags & (1 << 14)) != 0;
+  symbol.is_property = (flags & (1 << 13)) != 0;
+  symbol.is_macro = (flags & (1 << 12)) != 0;
+  symbol.is_exported = (flags & (1 << 11)) != 0;
+  symbol.is_input = (flags & (1 << 10)) != 0;
+  symbol.is_output = (flags & (1 << 9)) != 0;
+  symbol.is_state_var = (flags & (1 << 8)) != 0;
+  symbol.is_parameter = (flags & (1 << 7)) != 0;
+  symbol.is_auxiliary = (flags & (1 << 6)) != 0;
+  symbol.is_lvalue = (flags & (1 << 5)) != 0;
+  symbol.is_static_lifetime = (flags & (1 << 4)) != 0;
+  symbol.is_thread_local = (flags & (1 << 3)) != 0;
+  symbol.is_file_local = (flags & (1 << 2)) != 0;
+  symbol.is_extern = (flags & (1 << 1)) != 0;
+  symbol.is_volatile = (flags & 1) != 0;
+
+  return symbol;
+}
+
+static void write_exprs(
+  std::ostream &out,
+  const std::vector<exprt> &exprs,
+  irep_serializationt &irepconverter)
+{
+  write_gb_word(out, exprs.size());
+  for(const auto &expr : exprs)
+    irepconverter.reference_convert(expr, out);
+}
+
+static std::vector<exprt>
+read_exprs(std::istream &in, irep_serializationt &irepconverter)
+{
+  std::vector<exprt> exprs;
+  const std::size_t count = irepconverter.read_gb_word(in);
+  exprs.reserve(count);
+  for(std::size_t i = 0; i < count; ++i)
+    exprs.push_back(
+      static_cast<const exprt &>(irepconverter.reference_convert(in)));
+  return exprs;
+}
+
+static void write_instruction(
+  std::ostream &out,
+  const goto_programt::instructiont &instruction,
+  irep_serializationt &irepconverter)
+{
+  write_gb_word(out, static_cast<std::size_t>(instruction.type()));
+  irepconverter.reference_convert(instruction.code(), out);
+  irepconverter.reference_convert(
+    instruction.has_condition() ? instruction.condition() : nil_exprt(), out);
+}
+
+/// Read an instruction that \ref write_instruction wrote and compare it to
+/// \p instruction, ignoring comments such as source locations
+/// \return true if the instructions differ, false otherwise
+static bool read_instruction_differs(
+  std::istream &in,
+  const goto_programt::instructiont &instruction,
+  irep_serializationt &irepconverter)
+{
+  const auto type =
+    static_cast<goto_program_instruction_typet>(irepconverter.read_gb_word(in));
+  const irept code = irepconverter.reference_convert(in);
+  const irept condition = irepconverter.reference_convert(in);
+
+  // assertions may have been disabled since, e.g. via --property
+  if(type == ASSERT && instruction.is_skip())
+    return false;
+
+  return type != instruction.type() || code != instruction.code() ||
+         condition != (instruction.has_condition() ? instruction.condition()
+                                                   : nil_exprt());
+}
+
+void write_equation_binary(
+  std::ostream &out,
+  const symex_target_equationt &equation,
+  const symbol_tablet &symex_symbol_table,
+  abstract_goto_modelt &goto_model)
+{
+  // header
+  out << char(0x7f) << "SSA";
+  write_gb_word(out, EQUATION_BINARY_VERSION);
+
+  irep_serializationt::ireps_containert irepc;
+  irep_serializationt irepconverter(irepc);
+
+  // symbols introduced by symbolic execution
+  write_gb_word(out, symex_symbol_table.symbols.size());
+  for(const auto &symbol_pair : symex_symbol_table.symbols)
+    write_symbol(out, symbol_pair.second, irepconverter);
+
+  // positions of instructions within their function
+  std::unordered_map<
+    irep_idt,
+    std::unordered_map<const goto_programt::instructiont *, std::size_t>>
+    positions;
+  for(const auto &step : equation.SSA_steps)
+  {
+    positions.emplace(
+      step.source.function_id,
+      std::unordered_map<const goto_programt::instructiont *, std::size_t>{});
+  }
+
+  // the functions that the steps refer to, such that reading the equation
+  // can check that it is read with the same program
+  write_gb_word(out, positions.size());
+  for(auto &entry : positions)
+  {
+    irepconverter.write_string_ref(out, entry.first);
+
+    const goto_programt &body =
+      goto_model.get_goto_function(entry.first).body;
+    write_gb_word(out, body.instructions.size());
+
+    std::size_t position = 0;
+    for(const auto &instruction : body.instructions)
+    {
+      entry.second.emplace(&instruction, position++);
+      write_instruction(out, instruction, irepconverter);
+    }
+  }
+
+  write_gb_word(out, equation.SSA_steps.size());
+  for(const auto &step : equation.SSA_steps)
+  {
+    const auto &function_positions = positions.at(step.source.function_id);
+    const auto position = function_positions.find(&*step.source.pc);
+    INVARIANT(
+      position != function_positions.end(),
+      "SSA step must refer to an instruction of its function");
+
+    write_gb_word(out, step.source.thread_nr);
+    irepconverter.write_string_ref(out, step.source.function_id);
+    write_gb_word(out, position->second);
+    write_gb_word(out, static_cast<std::size_t>(step.type));
+
+    unsigned flags = 0;
+    flags = (flags << 1) | static_cast<int>(step.hidden);
+    flags = (flags << 1) | static_cast<int>(step.formatted);
+    flags = (flags << 1) | static_cast<int>(step.ignore);
+    write_gb_word(out, flags);
+
+    irepconverter.reference_convert(step.guard, out);
+    irepconverter.reference_convert(step.ssa_lhs, out);
+    irepconverter.reference_convert(step.ssa_full_lhs, out);
+    irepconverter.reference_convert(step.original_full_lhs, out);
+    irepconverter.reference_convert(step.ssa_rhs, out);
+    write_gb_word(out, static_cast<std::size_t>(step.assignment_type));
+    irepconverter.reference_convert(step.cond_expr, out);
+    write_gb_string(out, step.comment);
+
+    irepconverter.write_string_ref(out, step.format_string);
+    irepconverter.write_string_ref(out, step.io_id);
+    write_exprs(
+      out,
+      std::vector<exprt>{step.io_args.begin(), step.io_args.end()},
+      irepconverter);
+
+    irepconverter.write_string_ref(out, step.called_function);
+    write_exprs(out, step.ssa_function_arguments, irepconverter);
+
+    write_gb_word(out, step.atomic_section_id);
+  }
+}
+
+bool write_equation_binary(
+  const std::string &filename,
+  const symex_target_equationt &equation,
+  const symbol_tablet &symex_symbol_table,
+  abstract_goto_modelt &goto_model,
+  message_handlert &message_handler)
+{
+#ifdef _MSC_VER
+  std::ofstream out(widen(filename), std::ios::binary);
+#else
+  std::ofstream out(filename, std::ios::binary);
+#endif
+
+  if(!out)
+  {
+    messaget message(message_handler);
+    message.error() << "Failed to open '" << filename << "'" << messaget::eom;
+    return true;
+  }
+
+  write_equation_binary(out, equation, symex_symbol_table, goto_model);
+
+  return !out;
+}
+
+void read_equation_binary(
+  std::istream &in,
+  symex_target_equationt &equation,
+  symbol_tablet &symex_symbol_table,
+  abstract_goto_modelt &goto_model)
+{
+  char hdr[4];
+  in.read(hdr, 4);
+  if(!in || hdr[0] != 0x7f || hdr[1] != 'S' || hdr[2] != 'S' || hdr[3] != 'A')
+    throw deserialization_exceptiont("not a binary SSA equation");
+
+  const std::size_t version = irep_serializationt::read_gb_word(in);
+  if(version != EQUATION_BINARY_VERSION)
+  {
+    throw deserialization_exceptiont(
+      "unsupported binary SSA equation version " + std::to_string(version) +
+      ", supported version = " + std::to_string(EQUATION_BINARY_VERSION));
+  }
+
+  irep_serializationt::ireps_containert irepc;
+  irep_serializationt irepconverter(irepc);
+
+  const std::size_t symbol_count = irepconverter.read_gb_word(in);
+  for(std::size_t i = 0; i < symbol_count; ++i)
+    symex_symbol_table.insert(read_symbol(in, irepconverter));
+
+  // instructions of each function by position
+  std::unordered_map<irep_idt, std::vector<goto_programt::const_targett>>
+    instructions;
+
+  const std::size_t function_count = irepconverter.read_gb_word(in);
+  for(std::size_t i = 0; i < function_count; ++i)
+  {
+    const irep_idt function_id = irepconverter.read_string_ref(in);
+    if(!goto_model.can_produce_function(function_id))
+    {
+      throw deserialization_exceptiont(
+        "SSA equation refers to unknown function '" + id2string(function_id) +
+        "'");
+    }
+
+    const goto_programt &body = goto_model.get_goto_function(function_id).body;
+    const std::size_t instruction_count = irepconverter.read_gb_word(in);
+    bool differs = instruction_count != body.instructions.size();
+
+    auto &function_instructions = instructions[function_id];
+    for(auto it = body.instructions.begin();
+        !differs && it != body.instructions.end();
+        ++it)
+    {
+      differs = read_instruction_differs(in, *it, irepconverter);
+      function_instructions.push_back(it);
+    }
+
+    if(differs)
+    {
+      throw deserialization_exceptiont(
+        "SSA equation was generated from another version of function '" +
+        id2string(function_id) + "'");
+    }
+  }
+
+  const std::size_t step_count = irepconverter.read_gb_word(in);
+  for(std::size_t i = 0; i < step_count; ++i)
+  {
+    const std::size_t thread_nr = irepconverter.read_gb_word(in);
+    const irep_idt function_id = irepconverter.read_string_ref(in);
+    const std::size_t position = irepconverter.read_gb_word(in);
+
+    const auto entry = instructions.find(function_id);
+    if(entry == instructions.end() || position >= entry->second.size())
+    {
+      throw deserialization_exceptiont(
+        "SSA equation does not match the instructions of function '" +
+        id2string(function_id) + "'");
+    }
+
+    const auto type =
+      static_cast<goto_trace_stept::typet>(irepconverter.read_gb_word(in));
+    symex_targett::sourcet source{function_id, entry->second[position]};
+    source.thread_nr = narrow_cast<unsigned>(thread_nr);
+    SSA_stept step{source, type};
+
+    const std::size_t flags = irepconverter.read_gb_word(in);
+    step.hidden = (flags & (1 << 2)) != 0;
+    step.formatted = (flags & (1 << 1)) != 0;
+    step.ignore = (flags & 1) != 0;
+
+    step.guard =
+      static_cast<const exprt &>(irepconverter.reference_convert(in));
+    step.ssa_lhs =
+      static_cast<const ssa_exprt &>(irepconverter.reference_convert(in));
+    step.ssa_full_lhs =
+      static_cast<const exprt &>(irepconverter.reference_convert(in));
+    step.original_full_lhs =
+      static_cast<const exprt &>(irepconverter.reference_convert(in));
+    step.ssa_rhs =
+      static_cast<const exprt &>(irepconverter.reference_convert(in));
+    step.assignment_type = static_cast<symex_targett::assignment_typet>(
+      irepconverter.read_gb_word(in));
+    step.cond_expr =
+      static_cast<const exprt &>(irepconverter.reference_convert(in));
+    step.comment = id2string(irepconverter.read_gb_string(in));
+
+    step.format_string = irepconverter.read_string_ref(in);
+    step.io_id = irepconverter.read_string_ref(in);
+    const std::vector<exprt> io_args = read_exprs(in, irepconverter);
+    step.io_args.assign(io_args.begin(), io_args.end());
+
+    step.called_function = irepconverter.read_string_ref(in);
+    step.ssa_function_arguments = read_exprs(in, irepconverter);
+
+    step.atomic_section_id =
+      narrow_cast<unsigned>(irepconverter.read_gb_word(in));
+
+    if(!in)
+      throw deserialization_exceptiont("truncated binary SSA equation");
+
+    // assertions that have been disabled in the goto model since the equation
+    // was written, e.g., via --property, behave like SKIP instructions
+    if(step.is_assert() && step.source.pc->is_skip())
+    {
+      step.type = goto_trace_stept::typet::LOCATION;
+      step.cond_expr.make_nil();
+      step.comment.clear();
+    }
+
+    equation.SSA_steps.push_back(std::move(step));
+  }
+}
+
+void read_equation_binary(
+  const std::string &filename,
+  symex_target_equationt &equation,
+  symbol_tablet &symex_symbol_table,
+  abstract_goto_modelt &goto_model)
+{
+#ifdef _MSC_VER
+  std::ifstream in(widen(filename), std::ios::binary);
+#else
+  std::ifstream in(filename, std::ios::binary);
+#endif
+
+  if(!in)
+    throw system_exceptiont("failed to open '" + filename + "'");
+
+  read_equation_binary(in, equation, symex_symbol_table, goto_model);
+}
@@ -0,0 +1,76 @@
+/*******************************************************************\
+
+Module: Binary serialization of SSA equations
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Binary serialization of SSA equations, permitting to re-run the decision
+/// procedure on an equation without repeating symbolic execution
+
+#ifndef CPROVER_GOTO_SYMEX_EQUATION_BINARY_H
+#define CPROVER_GOTO_SYMEX_EQUATION_BINARY_H
+
+#define EQUATION_BINARY_VERSION 2
+
+#include <iosfwd>
+#include <string>
+
+class abstract_goto_modelt;
+class message_handlert;
+class symbol_tablet;
+class symex_target_equationt;
+
+/// Write \p equation in binary format to \p out. Program locations referenced
+/// by the steps of the equation are stored as positions in the functions of
+/// \p goto_model, which the equation was generated from. The instructions of
+/// these functions are stored as well, such that reading the equation can
+/// check that it is read with the same program.
+/// \param out: the stream to write to
+/// \param equation: the equation to write
+/// \param symex_symbol_table: symbols introduced by symbolic execution
+/// \param goto_model: the goto model that \p equation was generated from
+void write_equation_binary(
+  std::ostream &out,
+  const symex_target_equationt &equation,
+  const symbol_tablet &symex_symbol_table,
+  abstract_goto_modelt &goto_model);
+
+/// Write \p equation in binary format to the file \p filename, see
+/// \ref write_equation_binary(std::ostream &, const symex_target_equationt &, const symbol_tablet &, abstract_goto_modelt &)
+/// \return true on error, false otherwise
+bool write_equation_binary(
+  const std::string &filename,
+  const symex_target_equationt &equation,
+  const symbol_tablet &symex_symbol_table,
+  abstract_goto_modelt &goto_model,
+  message_handlert &message_handler);
+
+/// Read an equation in binary format from \p in and append its steps to
+/// \p equation. Throws a \ref deserialization_exceptiont if \p in is not a
+/// binary equation, or was written with functions that do not exist in
+/// \p goto_model or whose instructions differ from those in \p goto_model.
+/// \param in: the stream to read from
+/// \param [out] equation: the equation to append the steps to
+/// \param [out] symex_symbol_table: receives the symbols introduced by
+///   symbolic execution
+/// \param goto_model: the goto model that the equation was generated from;
+///   assertions that are no longer part of \p goto_model (for example as they
+///   have been disabled via `--property`) are turned into location steps
+void read_equation_binary(
+  std::istream &in,
+  symex_target_equationt &equation,
+  symbol_tablet &symex_symbol_table,
+  abstract_goto_modelt &goto_model);
+
+/// Read an equation in binary format from the file \p filename, see
+/// \ref read_equation_binary(std::istream &, symex_target_equationt &, symbol_tablet &, abstract_goto_modelt &)
+void read_equation_binary(
+  const std::string &filename,
+  symex_target_equationt &equation,
+  symbol_tablet &symex_symbol_table,
+  abstract_goto_modelt &goto_model);
+
+#endif // CPROVER_GOTO_SYMEX_EQUATION_BINARY_H
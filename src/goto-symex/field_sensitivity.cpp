@@ -12,6 +12,8 @@ Author: Michael Tautschnig
 #include <util/simplify_expr.h>
 #include <util/std_expr.h>
 
+#include <goto-programs/goto_program.h>
+
 #include "goto_symex_state.h"
 #include "symex_target.h"
 
@@ -146,6 +148,22 @@ exprt field_sensitivityt::apply(
           return index_exprt{std::move(expanded_array), index.index()};
         }
       }
+      else if(!write && l2_index.get().id() == ID_constant)
+      {
+        // sparse field sensitivity: use the individual cell symbol in case
+        // this index of a large array is being tracked
+        const std::set<mp_integer> *indices = tracked_indices(tmp);
+        const mp_integer mp_index =
+          numeric_cast_v<mp_integer>(to_constant_expr(l2_index.get()));
+        if(indices != nullptr && indices->count(mp_index) != 0)
+        {
+          ssa_exprt cell = sparse_cell(tmp, mp_index);
+          if(was_l2)
+            return state.rename(std::move(cell), ns).get();
+          else
+            return std::move(cell);
+        }
+      }
     }
   }
 #endif // ENABLE_ARRAY_FIELD_SENSITIVITY
@@ -363,3 +381,222 @@ bool field_sensitivityt::is_divisible(const ssa_exprt &expr) const
 
   return false;
 }
+
+const std::set<mp_integer> *
+field_sensitivityt::tracked_indices(const ssa_exprt &expr) const
+{
+  if(!sparse_array_indices || expr.type().id() != ID_array)
+    return nullptr;
+
+  // cells that would themselves be divisible are not supported
+  const typet &element_type = to_array_type(expr.type()).element_type();
+  if(
+    element_type.id() == ID_struct || element_type.id() == ID_struct_tag ||
+    element_type.id() == ID_array)
+  {
+    return nullptr;
+  }
+
+  const exprt &size = to_array_type(expr.type()).size();
+  if(
+    size.id() != ID_constant ||
+    numeric_cast_v<mp_integer>(to_constant_expr(size)) <=
+      max_field_sensitivity_array_size)
+  {
+    return nullptr;
+  }
+
+  const exprt &original = expr.get_original_expr();
+  if(original.id() != ID_symbol)
+    return nullptr;
+
+  const auto entry =
+    sparse_array_indices->find(to_symbol_expr(original).get_identifier());
+  if(entry == sparse_array_indices->end())
+    return nullptr;
+
+  return &entry->second;
+}
+
+ssa_exprt
+field_sensitivityt::sparse_cell(const ssa_exprt &expr, const mp_integer &index)
+{
+  const array_typet &type = to_array_type(expr.type());
+
+  ssa_exprt cell = expr;
+  cell.remove_level_2();
+  cell.set_expression(index_exprt{expr.get_original_expr(),
+                                  from_integer(index, type.index_type())});
+
+  return cell;
+}
+
+bool field_sensitivityt::collect_sparse_array_indices(
+  const goto_programt &goto_program,
+  const namespacet &ns,
+  std::size_t max_array_size,
+  sparse_array_indicest &dest)
+{
+  for(const auto &instruction : goto_program.instructions)
+  {
+    // cell symbols are not kept consistent across threads
+    if(instruction.is_start_thread())
+      return false;
+
+    instruction.apply([&ns, max_array_size, &dest](const exprt &expr) {
+      expr.visit_pre([&ns, max_array_size, &dest](const exprt &e) {
+        if(
+          e.id() != ID_index || to_index_expr(e).array().id() != ID_symbol ||
+          to_index_expr(e).array().type().id() != ID_array)
+        {
+          return;
+        }
+
+        const index_exprt &index = to_index_expr(e);
+        const auto size =
+          numeric_cast<mp_integer>(to_array_type(index.array().type()).size());
+        if(!size.has_value() || *size <= max_array_size)
+          return;
+
+        const auto mp_index =
+          numeric_cast<mp_integer>(simplify_expr(index.index(), ns));
+        if(mp_index.has_value() && *mp_index >= 0 && *mp_index < *size)
+        {
+          dest[to_symbol_expr(index.array()).get_identifier()].insert(
+            *mp_index);
+        }
+      });
+    });
+  }
+
+  return true;
+}
+
+std::vector<ssa_exprt>
+field_sensitivityt::get_sparse_fields(const ssa_exprt &expr) const
+{
+  std::vector<ssa_exprt> result;
+
+  const std::set<mp_integer> *indices = tracked_indices(expr);
+  if(indices == nullptr)
+    return result;
+
+  result.reserve(indices->size());
+  for(const mp_integer &index : *indices)
+    result.push_back(sparse_cell(expr, index));
+
+  return result;
+}
+
+/// Compute the value of cell \p index of the array value \p array that is
+/// being assigned to the array symbol \p l2_lhs.
+/// \param ns: a namespace to resolve type symbols/tag types
+/// \param state: symbolic execution state
+/// \param array: (sub-expression of) the L2 value assigned to \p l2_lhs
+/// \param l2_lhs: the array symbol that has been assigned to (L2)
+/// \param index: the index of the cell
+/// \param old_value: the value of the cell symbol before the assignment
+/// \return The new value of the cell, or an empty optional if the cell is not
+///   modified by the assignment.
+optionalt<exprt> field_sensitivityt::sparse_cell_value(
+  const namespacet &ns,
+  goto_symex_statet &state,
+  const exprt &array,
+  const ssa_exprt &l2_lhs,
+  const mp_integer &index,
+  const exprt &old_value) const
+{
+  if(array.id() == ID_with && array.operands().size() == 3)
+  {
+    const with_exprt &with_expr = to_with_expr(array);
+    const auto where = numeric_cast<mp_integer>(with_expr.where());
+    if(where.has_value())
+    {
+      if(*where == index)
+        return apply(ns, state, with_expr.new_value(), false);
+      else
+        return sparse_cell_value(
+          ns, state, with_expr.old(), l2_lhs, index, old_value);
+    }
+  }
+  else if(array.id() == ID_if)
+  {
+    const if_exprt &if_expr = to_if_expr(array);
+    const auto true_value = sparse_cell_value(
+      ns, state, if_expr.true_case(), l2_lhs, index, old_value);
+    const auto false_value = sparse_cell_value(
+      ns, state, if_expr.false_case(), l2_lhs, index, old_value);
+    if(!true_value.has_value() && !false_value.has_value())
+      return {};
+
+    return if_exprt{if_expr.cond(),
+                    true_value.value_or(old_value),
+                    false_value.value_or(old_value)};
+  }
+  else if(
+    is_ssa_expr(array) && to_ssa_expr(array).get_l1_object_identifier() ==
+                            l2_lhs.get_l1_object_identifier())
+  {
+    // A previous version of the array, whose cells are up to date. The
+    // current version, however, is fresh (as is the case for declarations)
+    // and its cells need to be assigned.
+    if(array != l2_lhs)
+      return {};
+    else
+      return index_exprt{
+        array, from_integer(index, to_array_type(array.type()).index_type())};
+  }
+
+  return apply(
+    ns,
+    state,
+    index_exprt{
+      array, from_integer(index, to_array_type(array.type()).index_type())},
+    false);
+}
+
+void field_sensitivityt::sparse_field_assignments(
+  const namespacet &ns,
+  goto_symex_statet &state,
+  const ssa_exprt &lhs,
+  const exprt &rhs,
+  symex_targett &target,
+  bool allow_pointer_unsoundness)
+{
+  const std::set<mp_integer> *indices = tracked_indices(lhs);
+  if(indices == nullptr)
+    return;
+
+  const ssa_exprt l2_lhs = state.rename_ssa<L2>(lhs, ns).get();
+
+  for(const mp_integer &index : *indices)
+  {
+    const ssa_exprt cell = sparse_cell(lhs, index);
+    const exprt old_value = state.rename(cell, ns).get();
+
+    auto new_value =
+      sparse_cell_value(ns, state, rhs, l2_lhs, index, old_value);
+    if(!new_value.has_value())
+      continue;
+
+    simplify(*new_value, ns);
+    if(*new_value == old_value)
+      continue;
+
+    const ssa_exprt ssa_lhs =
+      state
+        .assignment(
+          cell, *new_value, ns, true, true, allow_pointer_unsoundness)
+        .get();
+
+    // the assignment to the array itself is already part of the trace
+    target.assignment(
+      state.guard.as_expr(),
+      ssa_lhs,
+      ssa_lhs,
+      ssa_lhs.get_original_expr(),
+      *new_value,
+      state.source,
+      symex_targett::assignment_typet::HIDDEN);
+  }
+}
@@ -10,15 +10,28 @@ Author: Michael Tautschnig
 #define CPROVER_GOTO_SYMEX_FIELD_SENSITIVITY_H
 
 #include <cstddef>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
 
+#include <util/irep.h>
+#include <util/mp_arith.h>
 #include <util/nodiscard.h>
+#include <util/optional.h>
 
 class exprt;
 class ssa_exprt;
 class namespacet;
+class goto_programt;
 class goto_symex_statet;
 class symex_targett;
 
+/// Constant indices at which arrays too large for (dense) field sensitivity
+/// are accessed, keyed by the identifier of the array symbol.
+typedef std::unordered_map<irep_idt, std::set<mp_integer>>
+  sparse_array_indicest;
+
 /// Control granularity of object accesses
 ///
 /// [Field sensitivity](\ref field_sensitivityt) is a transformation of the
@@ -79,6 +92,17 @@ class symex_targett;
 /// `array[[0]] = other_array[[0]]`;
 /// `array[[1]] = other_array[[1]]`; etc.
 /// See \ref field_sensitivityt::field_assignments.
+///
+/// ### Sparse field sensitivity for large arrays
+/// Arrays exceeding \c max_field_sensitivity_array_size can optionally be
+/// treated sparsely (see \ref field_sensitivityt::set_sparse_array_indices):
+/// only those constant indices that the program actually uses (as collected
+/// by \ref field_sensitivityt::collect_sparse_array_indices) are given
+/// individual symbols `array[[index]]`, while the array symbol itself remains
+/// the (indivisible) residual object and is updated as before. Reads at such
+/// indices use the cell symbol, and each assignment to the array updates the
+/// cell symbols it may affect.
+/// See \ref field_sensitivityt::sparse_field_assignments.
 class field_sensitivityt
 {
 public:
@@ -151,12 +175,84 @@ class field_sensitivityt
   /// SSA expression.
   bool is_divisible(const ssa_exprt &expr) const;
 
+  /// Enable sparse field sensitivity for arrays larger than
+  /// \c max_field_sensitivity_array_size, using the constant indices in
+  /// \p indices.
+  /// \param indices: indices to track per array symbol, as computed by
+  ///   \ref collect_sparse_array_indices
+  void
+  set_sparse_array_indices(std::shared_ptr<const sparse_array_indicest> indices)
+  {
+    sparse_array_indices = std::move(indices);
+  }
+
+  /// Collect the constant indices at which arrays of constant size larger
+  /// than \p max_array_size are accessed in \p goto_program and add them to
+  /// \p dest.
+  /// \param goto_program: program to scan
+  /// \param ns: a namespace to resolve type symbols/tag types
+  /// \param max_array_size: maximum size for which (dense) field sensitivity
+  ///   is applied to array cells
+  /// \param [in,out] dest: the collected indices
+  /// \return False, if and only if, \p goto_program spawns threads, in which
+  ///   case sparse field sensitivity must not be used.
+  static bool collect_sparse_array_indices(
+    const goto_programt &goto_program,
+    const namespacet &ns,
+    std::size_t max_array_size,
+    sparse_array_indicest &dest);
+
+  /// Compute the individual cell symbols that sparse field sensitivity
+  /// maintains for the (L1 or L2) array symbol \p expr.
+  /// \param expr: the array symbol
+  /// \return L1 symbols `expr[[index]]` for each tracked index, or an empty
+  ///   vector if \p expr is not subject to sparse field sensitivity.
+  std::vector<ssa_exprt> get_sparse_fields(const ssa_exprt &expr) const;
+
+  /// Update the individual cell symbols of the array symbol \p lhs, which
+  /// is subject to sparse field sensitivity, after \p lhs was assigned the
+  /// value \p rhs. Only those cells are assigned that \p rhs may have
+  /// modified.
+  /// \param ns: a namespace to resolve type symbols/tag types
+  /// \param state: symbolic execution state
+  /// \param lhs: array symbol (L1)
+  /// \param rhs: the (L2) value assigned to \p lhs
+  /// \param target: symbolic execution equation store
+  /// \param allow_pointer_unsoundness: allow pointer unsoundness
+  void sparse_field_assignments(
+    const namespacet &ns,
+    goto_symex_statet &state,
+    const ssa_exprt &lhs,
+    const exprt &rhs,
+    symex_targett &target,
+    bool allow_pointer_unsoundness);
+
 private:
   /// whether or not to invoke \ref field_sensitivityt::apply
   bool run_apply = true;
 
   const std::size_t max_field_sensitivity_array_size;
 
+  /// Indices tracked by sparse field sensitivity, or nullptr if sparse field
+  /// sensitivity is disabled.
+  std::shared_ptr<const sparse_array_indicest> sparse_array_indices;
+
+  /// \return The set of indices tracked for array symbol \p expr, or nullptr
+  ///   if \p expr is not subject to sparse field sensitivity.
+  const std::set<mp_integer> *tracked_indices(const ssa_exprt &expr) const;
+
+  /// Build the L1 cell symbol `expr[[index]]` of array symbol \p expr.
+  static ssa_exprt
+  sparse_cell(const ssa_exprt &expr, const mp_integer &index);
+
+  optionalt<exprt> sparse_cell_value(
+    const namespacet &ns,
+    goto_symex_statet &state,
+    const exprt &array,
+    const ssa_exprt &l2_lhs,
+    const mp_integer &index,
+    const exprt &old_value) const;
+
   void field_assignments_rec(
     const namespacet &ns,
     goto_symex_statet &state,
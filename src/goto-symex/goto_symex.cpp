@@ -34,7 +34,10 @@ unsigned goto_symext::dynamic_counter=0;
 void goto_symext::do_simplify(exprt &expr)
 {
   if(symex_config.simplify_opt)
+  {
+    symex_profilert::phaset profile_phase(profiler.get(), "simplify");
     simplify(expr, ns);
+  }
 }
 
 void goto_symext::symex_assign(
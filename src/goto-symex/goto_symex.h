@@ -12,10 +12,12 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_GOTO_SYMEX_GOTO_SYMEX_H
 #define CPROVER_GOTO_SYMEX_GOTO_SYMEX_H
 
+#include <util/make_unique.h>
 #include <util/message.h>
 
 #include "complexity_limiter.h"
 #include "symex_config.h"
+#include "symex_profiler.h"
 
 class address_of_exprt;
 class code_function_callt;
@@ -65,7 +67,9 @@ class goto_symext
       path_segment_vccs(0),
       _total_vccs(std::numeric_limits<unsigned>::max()),
       _remaining_vccs(std::numeric_limits<unsigned>::max()),
-      complexity_module(mh, options)
+      complexity_module(mh, options),
+      profiler(
+        symex_config.profile ? util_make_unique<symex_profilert>() : nullptr)
   {
   }
 
@@ -813,7 +817,17 @@ class goto_symext
 
   complexity_limitert complexity_module;
 
+  /// Time spent per call stack, if \ref symex_configt::profile is set
+  std::unique_ptr<symex_profilert> profiler;
+
 public:
+  /// The profile recorded during symbolic execution, or nullptr if profiling
+  /// is not enabled
+  const symex_profilert *get_profile() const
+  {
+    return profiler.get();
+  }
+
   unsigned get_total_vccs() const
   {
     INVARIANT(
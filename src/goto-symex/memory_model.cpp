@@ -14,7 +14,7 @@ Author: Michael Tautschnig, michael.tautschnig@cs.ox.ac.uk
 #include <util/std_expr.h>
 
 memory_model_baset::memory_model_baset(const namespacet &_ns)
-  : partial_order_concurrencyt(_ns), var_cnt(0)
+  : partial_order_concurrencyt(_ns), lazy_constraints(false), var_cnt(0)
 {
 }
 
@@ -22,6 +22,11 @@ memory_model_baset::~memory_model_baset()
 {
 }
 
+bool memory_model_baset::refine(decision_proceduret &, message_handlert &)
+{
+  return false;
+}
+
 symbol_exprt memory_model_baset::nondet_bool_symbol(const std::string &prefix)
 {
   return symbol_exprt(
@@ -14,6 +14,8 @@ Author: Michael Tautschnig, michael.tautschnig@cs.ox.ac.uk
 
 #include "partial_order_concurrency.h"
 
+class decision_proceduret;
+
 class memory_model_baset : public partial_order_concurrencyt
 {
 public:
@@ -22,7 +24,32 @@ class memory_model_baset : public partial_order_concurrencyt
 
   virtual void operator()(symex_target_equationt &, message_handlert &) = 0;
 
+  /// Defer the generation of those constraints that are not required to
+  /// encode program order and the read-from relation (write serialisation
+  /// and from-read constraints, whose number is cubic in the number of shared
+  /// accesses). Deferred constraints are only added, via \ref refine, when a
+  /// model of the equation violates them.
+  /// \param lazy: true to defer constraints
+  void set_lazy_constraints(bool lazy)
+  {
+    lazy_constraints = lazy;
+  }
+
+  /// Check a model of the equation against the deferred constraints (see
+  /// \ref set_lazy_constraints) and add the violated ones to
+  /// \p decision_procedure.
+  /// \param decision_procedure: decision procedure that has just returned a
+  ///   satisfying assignment for the equation
+  /// \param message_handler: message handler to output statistics
+  /// \return True, if and only if, constraints were added and thus
+  ///   \p decision_procedure has to be run again.
+  virtual bool
+  refine(decision_proceduret &decision_procedure, message_handlert &);
+
 protected:
+  /// whether to defer constraints, see \ref set_lazy_constraints
+  bool lazy_constraints;
+
   /// In-thread program order
   /// \param e1: preceding event
   /// \param e2: following event
@@ -11,8 +11,11 @@ Author: Michael Tautschnig, michael.tautschnig@cs.ox.ac.uk
 
 #include "memory_model_sc.h"
 
+#include <util/simplify_expr.h>
 #include <util/std_expr.h>
 
+#include <solvers/decision_procedure.h>
+
 void memory_model_sct::
 operator()(symex_target_equationt &equation, message_handlert &message_handler)
 {
@@ -198,6 +201,12 @@ void memory_model_sct::program_order(
 void memory_model_sct::write_serialization_external(
   symex_target_equationt &equation)
 {
+  if(lazy_constraints)
+  {
+    deferred_write_serialization = true;
+    return;
+  }
+
   for(address_mapt::const_iterator
       a_it=address_map.begin();
       a_it!=address_map.end();
@@ -251,6 +260,12 @@ void memory_model_sct::from_read(symex_target_equationt &equation)
 {
   // from-read: (w', w) in ws and (w', r) in rf -> (r, w) in fr
 
+  if(lazy_constraints)
+  {
+    deferred_from_read = true;
+    return;
+  }
+
   for(address_mapt::const_iterator
       a_it=address_map.begin();
       a_it!=address_map.end();
@@ -335,3 +350,112 @@ void memory_model_sct::from_read(symex_target_equationt &equation)
     }
   }
 }
+
+exprt memory_model_sct::write_serialization(event_it w1, event_it w2)
+{
+  if(po(w1, w2) && !program_order_is_relaxed(w1, w2))
+    return true_exprt();
+  else if(po(w2, w1) && !program_order_is_relaxed(w2, w1))
+    return false_exprt();
+  else
+    return before(w1, w2);
+}
+
+bool memory_model_sct::refine(
+  decision_proceduret &decision_procedure,
+  message_handlert &message_handler)
+{
+  // anything that cannot be evaluated to true in the current model is
+  // considered violated
+  const auto holds = [this, &decision_procedure](const exprt &expr) {
+    return simplify_expr(decision_procedure.get(expr), ns).is_true();
+  };
+
+  std::size_t constraints_added = 0;
+  const auto add = [this, &decision_procedure, &constraints_added](
+                     const exprt &cond) {
+    decision_procedure.set_to_true(simplify_expr(cond, ns));
+    ++constraints_added;
+  };
+
+  if(deferred_write_serialization)
+  {
+    // write serialisation must totally order any two writes to the same
+    // address by different threads
+    for(const auto &address : address_map)
+    {
+      const event_listt &writes = address.second.writes;
+
+      for(auto w_it1 = writes.begin(); w_it1 != writes.end(); ++w_it1)
+      {
+        for(auto w_it2 = std::next(w_it1); w_it2 != writes.end(); ++w_it2)
+        {
+          if(
+            (*w_it1)->source.thread_nr == (*w_it2)->source.thread_nr ||
+            refined_write_serialization.count({*w_it1, *w_it2}) != 0)
+          {
+            continue;
+          }
+
+          if(
+            !holds((*w_it1)->guard) || !holds((*w_it2)->guard) ||
+            holds(before(*w_it1, *w_it2)) || holds(before(*w_it2, *w_it1)))
+          {
+            continue;
+          }
+
+          refined_write_serialization.emplace(*w_it1, *w_it2);
+
+          symbol_exprt s = nondet_bool_symbol("ws-ext");
+          add(implies_exprt(s, before(*w_it1, *w_it2)));
+          add(implies_exprt(not_exprt(s), before(*w_it2, *w_it1)));
+        }
+      }
+    }
+  }
+
+  if(deferred_from_read)
+  {
+    // if r reads from w' and w' is serialised before w, then r must happen
+    // before w
+    for(const auto &choice : choice_symbols)
+    {
+      const event_it r = choice.first.first;
+      const event_it w_prime = choice.first.second;
+      const exprt &rf = choice.second;
+
+      if(!holds(rf) || !holds(r->guard))
+        continue;
+
+      const event_listt &writes = address_map[address(w_prime)].writes;
+      for(const event_it &w : writes)
+      {
+        if(
+          w == w_prime ||
+          refined_from_read.count(std::make_tuple(r, w_prime, w)) != 0)
+        {
+          continue;
+        }
+
+        const exprt ws = write_serialization(w_prime, w);
+        if(ws.is_false() || !holds(w->guard) || !holds(ws))
+          continue;
+
+        const exprt fr = before(r, w);
+        if(holds(fr))
+          continue;
+
+        refined_from_read.emplace(r, w_prime, w);
+
+        // as in from_read, the guard of w_prime follows from rf
+        add(implies_exprt(and_exprt(r->guard, w->guard, ws, rf), fr));
+      }
+    }
+  }
+
+  messaget log{message_handler};
+  log.statistics() << "Memory model refinement added " << constraints_added
+                   << " constraints" << messaget::eom;
+
+  return constraints_added != 0;
+}
@@ -12,6 +12,9 @@ Author: Michael Tautschnig, michael.tautschnig@cs.ox.ac.uk
 #ifndef CPROVER_GOTO_SYMEX_MEMORY_MODEL_SC_H
 #define CPROVER_GOTO_SYMEX_MEMORY_MODEL_SC_H
 
+#include <set>
+#include <tuple>
+
 #include "memory_model.h"
 
 class memory_model_sct:public memory_model_baset
@@ -24,6 +27,9 @@ class memory_model_sct:public memory_model_baset
 
   virtual void operator()(symex_target_equationt &equation, message_handlert &);
 
+  bool refine(decision_proceduret &decision_procedure, message_handlert &)
+    override;
+
 protected:
   virtual exprt before(event_it e1, event_it e2);
   virtual bool program_order_is_relaxed(
@@ -39,6 +45,25 @@ class memory_model_sct:public memory_model_baset
   void program_order(symex_target_equationt &equation);
   void from_read(symex_target_equationt &equation);
   void write_serialization_external(symex_target_equationt &equation);
+
+  /// The write-serialisation order between writes \p w1 and \p w2 to the
+  /// same address, as used in from-read constraints
+  /// \return true if program order already places \p w1 before \p w2,
+  ///   false if it places \p w2 before \p w1, and a clock constraint
+  ///   otherwise
+  exprt write_serialization(event_it w1, event_it w2);
+
+  /// whether \ref write_serialization_external deferred its constraints
+  bool deferred_write_serialization = false;
+  /// whether \ref from_read deferred its constraints
+  bool deferred_from_read = false;
+
+  /// pairs of writes for which \ref refine already added write-serialisation
+  /// constraints
+  std::set<std::pair<event_it, event_it>> refined_write_serialization;
+  /// (read, read-from write, other write) triples for which \ref refine
+  /// already added a from-read constraint
+  std::set<std::tuple<event_it, event_it, event_it>> refined_from_read;
 };
 
 #endif // CPROVER_GOTO_SYMEX_MEMORY_MODEL_SC_H
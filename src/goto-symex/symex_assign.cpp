@@ -216,6 +216,18 @@ void symex_assignt::assign_non_struct_symbol(
     state.propagation.erase_if_exists(l1_lhs.get_identifier());
     state.value_set.erase_symbol(l1_lhs, ns);
   }
+  else
+  {
+    // Update those cells of a large array that sparse field sensitivity
+    // tracks individually, if any
+    state.field_sensitivity.sparse_field_assignments(
+      ns,
+      state,
+      l1_lhs,
+      assignment.rhs,
+      target,
+      symex_config.allow_pointer_unsoundness);
+  }
 }
 
 void symex_assignt::assign_symbol(
@@ -49,6 +49,11 @@ struct symex_configt final
   /// Maximum sizes for which field sensitivity will be applied to array cells
   std::size_t max_field_sensitivity_array_size;
 
+  /// \brief Whether arrays exceeding \ref max_field_sensitivity_array_size
+  ///   should have individual symbols for those cells that are accessed at
+  ///   constant indices (see \ref field_sensitivityt).
+  bool sparse_array_field_sensitivity;
+
   /// \brief Whether this run of symex is under complexity limits. This
   /// enables certain analyses that otherwise aren't run.
   bool complexity_limits_active;
@@ -61,6 +66,10 @@ struct symex_configt final
   ///   Used in goto_symext::dereference_rec
   bool cache_dereferences;
 
+  /// \brief Whether to record the time spent per call stack and instruction
+  ///   in a \ref symex_profilert
+  bool profile;
+
   /// \brief Construct a symex_configt using options specified in an
   /// \ref optionst
   explicit symex_configt(const optionst &options);
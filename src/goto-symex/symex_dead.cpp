@@ -65,4 +65,7 @@ void goto_symext::symex_dead(statet &state, const symbol_exprt &symbol_expr)
 
   const exprt fields = state.field_sensitivity.get_fields(ns, state, ssa);
   remove_l1_object_rec(state, fields, ns);
+
+  for(const ssa_exprt &cell : state.field_sensitivity.get_sparse_fields(ssa))
+    remove_l1_object_rec(state, cell, ns);
 }
@@ -52,6 +52,16 @@ void goto_symext::symex_decl(statet &state, const symbol_exprt &expr)
     hidden ? symex_targett::assignment_typet::HIDDEN
            : symex_targett::assignment_typet::STATE);
 
+  // cells tracked by sparse field sensitivity start out as the cells of the
+  // fresh array
+  state.field_sensitivity.sparse_field_assignments(
+    ns,
+    state,
+    remove_level_2(ssa),
+    ssa,
+    target,
+    symex_config.allow_pointer_unsoundness);
+
   if(path_storage.dirty(ssa.get_object_name()) && state.atomic_section_id == 0)
     target.shared_write(
       state.guard.as_expr(),
@@ -475,6 +475,8 @@ void goto_symext::dereference(exprt &expr, statet &state, bool write)
 {
   PRECONDITION(!state.call_stack().empty());
 
+  symex_profilert::phaset profile_phase(profiler.get(), "dereference");
+
   // Symbols whose address is taken need to be renamed to level 1
   // in order to distinguish addresses of local variables
   // from different frames.
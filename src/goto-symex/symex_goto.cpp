@@ -630,6 +630,8 @@ void goto_symext::merge_gotos(statet &state)
   if(state_map_it==frame.goto_state_map.end())
     return; // nothing to do
 
+  symex_profilert::phaset profile_phase(profiler.get(), "merge");
+
   // we need to merge
   framet::goto_state_listt &state_list = state_map_it->second;
 
@@ -52,9 +52,12 @@ symex_configt::symex_configt(const optionst &options)
             ? options.get_unsigned_int_option(
                 "max-field-sensitivity-array-size")
             : DEFAULT_MAX_FIELD_SENSITIVITY_ARRAY_SIZE),
+    sparse_array_field_sensitivity(
+      options.get_bool_option("sparse-array-field-sensitivity")),
     complexity_limits_active(
       options.get_signed_int_option("symex-complexity-limit") > 0),
-    cache_dereferences{options.get_bool_option("symex-cache-dereferences")}
+    cache_dereferences{options.get_bool_option("symex-cache-dereferences")},
+    profile(!options.get_option("symex-profile").empty())
 {
 }
 
@@ -439,6 +442,48 @@ std::unique_ptr<goto_symext::statet> goto_symext::initialize_entry_point_state(
 
   state->run_validation_checks = symex_config.run_validation_checks;
 
+  if(symex_config.sparse_array_field_sensitivity)
+  {
+    // Sparse field sensitivity requires the set of tracked cells to be fixed
+    // before any array is assigned to, thus collect them from all functions.
+    auto indices = std::make_shared<sparse_array_indicest>();
+    bool single_threaded = true;
+    for(const auto &symbol_pair : ns.get_symbol_table().symbols)
+    {
+      if(symbol_pair.second.type.id() != ID_code)
+        continue;
+
+      const goto_functionst::goto_functiont *function;
+      try
+      {
+        function = &get_goto_function(symbol_pair.first);
+      }
+      catch(const std::out_of_range &)
+      {
+        continue;
+      }
+
+      if(!field_sensitivityt::collect_sparse_array_indices(
+           function->body,
+           ns,
+           symex_config.max_field_sensitivity_array_size,
+           *indices))
+      {
+        single_threaded = false;
+        break;
+      }
+    }
+
+    if(single_threaded)
+      state->field_sensitivity.set_sparse_array_indices(std::move(indices));
+    else
+    {
+      log.warning() << "sparse array field sensitivity is not supported for "
+                       "multi-threaded programs"
+                    << messaget::eom;
+    }
+  }
+
   // initialize support analyses
   auto emplace_safe_pointers_result =
     path_storage.safe_pointers.emplace(entry_point_id, local_safe_pointerst{});
@@ -606,6 +651,9 @@ void goto_symext::execute_next_instruction(
 
   const goto_programt::instructiont &instruction=*state.source.pc;
 
+  symex_profilert::instructiont profile_instruction(
+    profiler.get(), state, target);
+
   if(!symex_config.doing_path_exploration)
     merge_gotos(state);
 
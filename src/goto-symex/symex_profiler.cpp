@@ -0,0 +1,212 @@
+/*******************************************************************\
+
+Module: Symbolic Execution Profiler
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Attribute the time spent in symbolic execution to call stacks
+
+#include "symex_profiler.h"
+
+#include <util/json.h>
+#include <util/json_irep.h>
+#include <util/suffix.h>
+#include <util/unicode.h>
+
+#include "goto_symex_state.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+symex_profilert::symex_profilert()
+  : current_location(nullptr), ssa_steps_before(0)
+{
+  nodes.emplace_back(0, irep_idt());
+
+  for(int type = NO_INSTRUCTION_TYPE; type <= INCOMPLETE_GOTO; ++type)
+  {
+    std::ostringstream name;
+    name << static_cast<goto_program_instruction_typet>(type);
+    instruction_names.push_back(name.str());
+  }
+}
+
+std::size_t symex_profilert::child(std::size_t node, const irep_idt &name)
+{
+  const auto entry = nodes[node].children.emplace(name, nodes.size());
+  if(entry.second)
+    nodes.emplace_back(node, name);
+  return entry.first->second;
+}
+
+void symex_profilert::enter(std::size_t node)
+{
+  active.push_back({node, clockt::now(), clockt::duration::zero()});
+}
+
+symex_profilert::clockt::duration symex_profilert::leave()
+{
+  PRECONDITION(!active.empty());
+
+  const activet entry = active.back();
+  active.pop_back();
+
+  const clockt::duration elapsed = clockt::now() - entry.start;
+  nodet &node = nodes[entry.node];
+  node.time += elapsed - entry.nested;
+  ++node.count;
+
+  if(!active.empty())
+    active.back().nested += elapsed;
+
+  return elapsed;
+}
+
+void symex_profilert::enter_instruction(
+  const goto_symex_statet &state,
+  std::size_t ssa_steps)
+{
+  PRECONDITION(current_location == nullptr);
+
+  // the first frame is the one of the entry point, each further frame was
+  // created by a call from the function of the frame below
+  std::size_t node = 0;
+  const call_stackt &call_stack = state.call_stack();
+  for(std::size_t i = 1; i < call_stack.size(); ++i)
+    node = child(node, call_stack[i].calling_location.function_id);
+  node = child(node, state.source.function_id);
+  node = child(
+    node, instruction_names[static_cast<std::size_t>(state.source.pc->type())]);
+
+  locationt &location = locations[&*state.source.pc];
+  if(location.function_id.empty())
+  {
+    location.function_id = state.source.function_id;
+    location.pc = state.source.pc;
+  }
+
+  current_location = &location;
+  ssa_steps_before = ssa_steps;
+  enter(node);
+}
+
+void symex_profilert::leave_instruction(std::size_t ssa_steps)
+{
+  PRECONDITION(current_location != nullptr);
+  PRECONDITION(ssa_steps >= ssa_steps_before);
+
+  const std::size_t node = active.back().node;
+  const clockt::duration elapsed = leave();
+
+  nodes[node].ssa_steps += ssa_steps - ssa_steps_before;
+
+  current_location->time += elapsed;
+  current_location->ssa_steps += ssa_steps - ssa_steps_before;
+  ++current_location->count;
+  current_location = nullptr;
+}
+
+void symex_profilert::output_folded(std::ostream &out) const
+{
+  // nodes are created after their parents, hence the stack of a node can be
+  // built from the stack of its parent
+  std::vector<std::string> stacks(nodes.size());
+  for(std::size_t i = 1; i < nodes.size(); ++i)
+  {
+    const nodet &node = nodes[i];
+    stacks[i] = node.parent == 0
+                  ? id2string(node.name)
+                  : stacks[node.parent] + ';' + id2string(node.name);
+
+    const auto microseconds =
+      std::chrono::duration_cast<std::chrono::microseconds>(node.time).count();
+    if(microseconds > 0)
+      out << stacks[i] << ' ' << microseconds << '\n';
+  }
+}
+
+static double seconds(symex_profilert::clockt::duration duration)
+{
+  return std::chrono::duration<double>(duration).count();
+}
+
+jsont symex_profilert::output_json() const
+{
+  json_arrayt json_stacks;
+
+  std::vector<std::size_t> order;
+  for(std::size_t i = 1; i < nodes.size(); ++i)
+    order.push_back(i);
+  std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+    return nodes[a].time > nodes[b].time;
+  });
+
+  for(const std::size_t i : order)
+  {
+    json_arrayt json_stack;
+    for(std::size_t n = i; n != 0; n = nodes[n].parent)
+      json_stack.push_back(json_stringt(nodes[n].name));
+    std::reverse(json_stack.begin(), json_stack.end());
+
+    json_stacks.push_back(json_objectt{
+      {"stack", std::move(json_stack)},
+      {"time", json_numbert(std::to_string(seconds(nodes[i].time)))},
+      {"ssaSteps", json_numbert(std::to_string(nodes[i].ssa_steps))},
+      {"count", json_numbert(std::to_string(nodes[i].count))}});
+  }
+
+  std::vector<const locationt *> sorted_locations;
+  sorted_locations.reserve(locations.size());
+  for(const auto &entry : locations)
+    sorted_locations.push_back(&entry.second);
+  std::sort(
+    sorted_locations.begin(),
+    sorted_locations.end(),
+    [](const locationt *a, const locationt *b) {
+      return a->time > b->time;
+    });
+
+  json_arrayt json_locations;
+  for(const locationt *location : sorted_locations)
+  {
+    json_objectt json_location{
+      {"function", json_stringt(location->function_id)},
+      {"instruction", json_stringt(instruction_names[static_cast<std::size_t>(
+                        location->pc->type())])},
+      {"time", json_numbert(std::to_string(seconds(location->time)))},
+      {"ssaSteps", json_numbert(std::to_string(location->ssa_steps))},
+      {"count", json_numbert(std::to_string(location->count))}};
+
+    const source_locationt &source_location = location->pc->source_location();
+    if(source_location.is_not_nil())
+      json_location["sourceLocation"] = json(source_location);
+
+    json_locations.push_back(std::move(json_location));
+  }
+
+  return json_objectt{{"stacks", std::move(json_stacks)},
+                      {"instructions", std::move(json_locations)}};
+}
+
+bool symex_profilert::output(const std::string &filename) const
+{
+#ifdef _MSC_VER
+  std::ofstream out(widen(filename));
+#else
+  std::ofstream out(filename);
+#endif
+
+  if(!out)
+    return true;
+
+  if(has_suffix(filename, ".json"))
+    out << output_json() << '\n';
+  else
+    output_folded(out);
+
+  return !out;
+}
@@ -0,0 +1,182 @@
+/*******************************************************************\
+
+Module: Symbolic Execution Profiler
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Attribute the time spent in symbolic execution to call stacks
+
+#ifndef CPROVER_GOTO_SYMEX_SYMEX_PROFILER_H
+#define CPROVER_GOTO_SYMEX_SYMEX_PROFILER_H
+
+#include <goto-programs/goto_program.h>
+
+#include "symex_target_equation.h"
+
+#include <chrono>
+#include <iosfwd>
+#include <unordered_map>
+#include <vector>
+
+class goto_symex_statet;
+class jsont;
+
+/// Aggregates the wall-clock time and the number of SSA steps that symbolic
+/// execution spends per call stack and per goto instruction.
+///
+/// Each executed instruction is attributed to the stack of functions that are
+/// active when it is executed, extended by the kind of the instruction, e.g.,
+/// `main;foo;ASSIGN`. Expensive parts of executing an instruction, such as
+/// dereferencing, simplification or merging of states, are timed as
+/// \ref phaset and attributed to a further frame, e.g.,
+/// `main;foo;ASSIGN;dereference`. Times are exclusive: the time of a frame does
+/// not include the time of the frames nested in it.
+///
+/// The result can be written as folded stacks, as consumed by flame graph
+/// tools, or as JSON, which additionally includes the inclusive time per
+/// instruction.
+class symex_profilert
+{
+public:
+  typedef std::chrono::steady_clock clockt;
+
+  symex_profilert();
+
+  /// Start attributing time to the instruction at the program counter of
+  /// \p state, see \ref instructiont
+  /// \param state: state that is about to execute an instruction
+  /// \param ssa_steps: number of SSA steps generated so far
+  void enter_instruction(const goto_symex_statet &state, std::size_t ssa_steps);
+
+  /// Stop attributing time to the instruction most recently entered
+  /// \param ssa_steps: number of SSA steps generated so far
+  void leave_instruction(std::size_t ssa_steps);
+
+  /// Time the execution of one instruction for the lifetime of this object.
+  /// Nothing is recorded if the profiler is null.
+  class instructiont
+  {
+  public:
+    instructiont(
+      symex_profilert *profiler,
+      const goto_symex_statet &state,
+      const symex_target_equationt &equation)
+      : profiler(profiler), equation(equation)
+    {
+      if(profiler)
+        profiler->enter_instruction(state, equation.SSA_steps.size());
+    }
+
+    ~instructiont()
+    {
+      if(profiler)
+        profiler->leave_instruction(equation.SSA_steps.size());
+    }
+
+    instructiont(const instructiont &) = delete;
+    instructiont &operator=(const instructiont &) = delete;
+
+  private:
+    symex_profilert *profiler;
+    const symex_target_equationt &equation;
+  };
+
+  /// Time a phase of symbolic execution, such as dereferencing, for the
+  /// lifetime of this object. Nothing is recorded if the profiler is null.
+  class phaset
+  {
+  public:
+    phaset(symex_profilert *profiler, const char *name) : profiler(profiler)
+    {
+      if(profiler)
+        profiler->enter(profiler->child(profiler->current_node(), name));
+    }
+
+    ~phaset()
+    {
+      if(profiler)
+        profiler->leave();
+    }
+
+    phaset(const phaset &) = delete;
+    phaset &operator=(const phaset &) = delete;
+
+  private:
+    symex_profilert *profiler;
+  };
+
+  /// Write one line per call stack in the format `frame;frame;... value`,
+  /// where the value is the exclusive time in microseconds
+  void output_folded(std::ostream &out) const;
+
+  /// Call stacks and instructions with their time in seconds, the number of
+  /// SSA steps generated and the number of times they were executed
+  jsont output_json() const;
+
+  /// Write the profile to \p filename as JSON if the name ends in `.json` and
+  /// as folded stacks otherwise
+  /// \return true on error, false otherwise
+  bool output(const std::string &filename) const;
+
+protected:
+  struct nodet
+  {
+    nodet(std::size_t parent, irep_idt name)
+      : parent(parent), name(std::move(name))
+    {
+    }
+
+    std::size_t parent;
+    irep_idt name;
+    std::unordered_map<irep_idt, std::size_t> children;
+    clockt::duration time = clockt::duration::zero();
+    std::size_t ssa_steps = 0;
+    std::size_t count = 0;
+  };
+
+  /// Node 0 is the root, which has no name
+  std::vector<nodet> nodes;
+
+  struct locationt
+  {
+    irep_idt function_id;
+    goto_programt::const_targett pc;
+    clockt::duration time = clockt::duration::zero();
+    std::size_t ssa_steps = 0;
+    std::size_t count = 0;
+  };
+
+  std::unordered_map<const goto_programt::instructiont *, locationt> locations;
+
+  /// Nodes that are currently being timed, innermost last
+  struct activet
+  {
+    std::size_t node;
+    clockt::time_point start;
+    clockt::duration nested;
+  };
+
+  std::vector<activet> active;
+
+  /// Instruction being timed, if any, and the number of SSA steps before
+  /// executing it
+  locationt *current_location;
+  std::size_t ssa_steps_before;
+
+  std::size_t current_node() const
+  {
+    return active.empty() ? 0 : active.back().node;
+  }
+
+  std::size_t child(std::size_t node, const irep_idt &name);
+  void enter(std::size_t node);
+  clockt::duration leave();
+
+  /// Names of the instruction kinds indexed by goto_program_instruction_typet
+  std::vector<irep_idt> instruction_names;
+};
+
+#endif // CPROVER_GOTO_SYMEX_SYMEX_PROFILER_H
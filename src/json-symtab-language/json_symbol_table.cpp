@@ -13,6 +13,8 @@ Author: Chris Smowton, chris.smowton@diffblue.com
 #include <util/json.h>
 #include <util/symbol_table.h>
 
+#include <json/streaming_json_reader.h>
+
 void symbol_table_from_json(const jsont &in, symbol_tablet &symbol_table)
 {
   if(!in.is_object())
@@ -52,3 +54,61 @@ void symbol_table_from_json(const jsont &in, symbol_tablet &symbol_table)
 
   symbol_table.validate(validation_modet::EXCEPTION);
 }
+
+void symbol_table_from_json(
+  std::istream &in,
+  const std::string &filename,
+  symbol_tablet &symbol_table)
+{
+  streaming_json_readert reader(in, filename);
+
+  if(reader.peek_kind() != jsont::kindt::J_OBJECT)
+  {
+    throw deserialization_exceptiont(
+      "symbol_table_from_json: JSON input must be an object");
+  }
+
+  bool found = false;
+  reader.begin_object();
+  while(const auto key = reader.next_key())
+  {
+    if(*key != "symbolTable")
+    {
+      reader.skip_value();
+      continue;
+    }
+
+    if(found)
+    {
+      throw deserialization_exceptiont(
+        "symbol_table_from_json: duplicate key `symbolTable`");
+    }
+    found = true;
+
+    if(reader.peek_kind() != jsont::kindt::J_OBJECT)
+    {
+      throw deserialization_exceptiont(
+        "symbol_table_from_json: JSON symbol table must be an object");
+    }
+
+    reader.begin_object();
+    while(reader.next_key())
+    {
+      symbolt symbol = symbol_from_json(reader.read_value());
+
+      if(symbol_table.add(symbol))
+        throw deserialization_exceptiont(
+          "symbol_table_from_json: duplicate symbol name `" +
+          id2string(symbol.name) + "`");
+    }
+  }
+  reader.end();
+
+  if(!found)
+  {
+    throw deserialization_exceptiont(
+      "symbol_table_from_json: JSON object must have key `symbolTable`");
+  }
+
+  symbol_table.validate(validation_modet::EXCEPTION);
+}
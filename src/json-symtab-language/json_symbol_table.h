@@ -9,9 +9,22 @@ Author: Chris Smowton, chris.smowton@diffblue.com
 #ifndef CPROVER_JSON_SYMTAB_LANGUAGE_JSON_SYMBOL_TABLE_H
 #define CPROVER_JSON_SYMTAB_LANGUAGE_JSON_SYMBOL_TABLE_H
 
+#include <iosfwd>
+#include <string>
+
 class jsont;
 class symbol_tablet;
 
 void symbol_table_from_json(const jsont &, symbol_tablet &);
 
+/// Read the symbol table of the JSON document in \p in one symbol at a time,
+/// such that the document is never held in memory as a whole.
+/// \param in: the stream to read the JSON document from
+/// \param filename: the name of the file, for error messages
+/// \param [out] symbol_table: the symbol table to add the symbols to
+void symbol_table_from_json(
+  std::istream &in,
+  const std::string &filename,
+  symbol_tablet &symbol_table);
+
 #endif
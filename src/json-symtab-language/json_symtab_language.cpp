@@ -10,11 +10,14 @@ Author: Chris Smowton, chris.smowton@diffblue.com
 
 #include "json_symtab_language.h"
 #include "json_symbol_table.h"
-#include <json/json_parser.h>
+
+#include <util/exception_utils.h>
 
 #include <linking/linking.h>
 
-/// Parse a goto program in json form.
+/// Parse a goto program in json form. The symbols are converted while the
+/// file is read, such that the JSON document is never held in memory as a
+/// whole.
 /// \param instream: The input stream
 /// \param path: A file path
 /// \return boolean signifying success or failure of the parsing
@@ -22,7 +25,19 @@ bool json_symtab_languaget::parse(
   std::istream &instream,
   const std::string &path)
 {
-  return parse_json(instream, path, get_message_handler(), parsed_json_file);
+  parsed_symbol_table.clear();
+
+  try
+  {
+    symbol_table_from_json(instream, path, parsed_symbol_table);
+    return false;
+  }
+  catch(const cprover_exception_baset &e)
+  {
+    error() << "parse: " << e.what() << eom;
+    parsed_symbol_table.clear();
+    return true;
+  }
 }
 
 /// Typecheck a goto program in json form.
@@ -35,24 +50,13 @@ bool json_symtab_languaget::typecheck(
 {
   (void)module; // unused parameter
 
-  symbol_tablet new_symbol_table;
-
-  try
-  {
-    symbol_table_from_json(parsed_json_file, new_symbol_table);
-    return linking(symbol_table, new_symbol_table, get_message_handler());
-  }
-  catch(const std::string &str)
-  {
-    error() << "typecheck: " << str << eom;
-    return true;
-  }
+  return linking(symbol_table, parsed_symbol_table, get_message_handler());
 }
 
-/// Output the result of the parsed json file to the output stream
+/// Output the symbols of the parsed json file to the output stream
 /// passed as a parameter to this function.
-/// \param out: The stream to use to output the parsed_json_file.
+/// \param out: The stream to use to output the parsed_symbol_table.
 void json_symtab_languaget::show_parse(std::ostream &out)
 {
-  parsed_json_file.output(out);
+  parsed_symbol_table.show(out);
 }
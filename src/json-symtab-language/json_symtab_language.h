@@ -17,7 +17,6 @@ Author: Chris Smowton, chris.smowton@diffblue.com
 #include <goto-programs/goto_functions.h>
 #include <langapi/language.h>
 
-#include <util/json.h>
 #include <util/make_unique.h>
 #include <util/symbol_table.h>
 
@@ -69,7 +68,7 @@ class json_symtab_languaget : public languaget
   ~json_symtab_languaget() override = default;
 
 protected:
-  jsont parsed_json_file;
+  symbol_tablet parsed_symbol_table;
 };
 
 inline std::unique_ptr<languaget> new_json_symtab_language()
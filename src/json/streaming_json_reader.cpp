@@ -0,0 +1,315 @@
+/*******************************************************************\
+
+Module: Streaming JSON Reader
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Streaming JSON Reader
+
+#include "streaming_json_reader.h"
+
+#include <util/exception_utils.h>
+#include <util/invariant.h>
+#include <util/unicode.h>
+
+#include <cctype>
+#include <istream>
+#include <utility>
+
+streaming_json_readert::streaming_json_readert(
+  std::istream &in,
+  std::string filename)
+  : buffer(*in.rdbuf()), filename(std::move(filename))
+{
+}
+
+int streaming_json_readert::peek()
+{
+  while(true)
+  {
+    const int c = buffer.sgetc();
+    if(c == '\n')
+      ++line;
+    else if(c != ' ' && c != '\t' && c != '\r')
+      return c;
+    buffer.sbumpc();
+  }
+}
+
+void streaming_json_readert::expect(char c)
+{
+  const int next = peek();
+  if(next != c)
+  {
+    error(
+      std::string("expected `") + c + "' but found " +
+      (next == EOF ? std::string("end of file")
+                   : "`" + std::string(1, static_cast<char>(next)) + "'"));
+  }
+  buffer.sbumpc();
+}
+
+jsont::kindt streaming_json_readert::peek_kind()
+{
+  switch(peek())
+  {
+  case '{':
+    return jsont::kindt::J_OBJECT;
+  case '[':
+    return jsont::kindt::J_ARRAY;
+  case '"':
+    return jsont::kindt::J_STRING;
+  case 't':
+    return jsont::kindt::J_TRUE;
+  case 'f':
+    return jsont::kindt::J_FALSE;
+  case 'n':
+    return jsont::kindt::J_NULL;
+  case '-':
+  case '0':
+  case '1':
+  case '2':
+  case '3':
+  case '4':
+  case '5':
+  case '6':
+  case '7':
+  case '8':
+  case '9':
+    return jsont::kindt::J_NUMBER;
+  default:
+    error("expected a value");
+  }
+}
+
+void streaming_json_readert::begin_object()
+{
+  expect('{');
+  objects.push_back(false);
+}
+
+optionalt<std::string> streaming_json_readert::next_key()
+{
+  PRECONDITION(!objects.empty());
+
+  if(peek() == '}')
+  {
+    buffer.sbumpc();
+    objects.pop_back();
+    return {};
+  }
+
+  if(objects.back())
+    expect(',');
+  objects.back() = true;
+
+  if(peek() != '"')
+    error("expected a key");
+  std::string key = string();
+  expect(':');
+
+  return std::move(key);
+}
+
+jsont streaming_json_readert::read_value()
+{
+  jsont result;
+  value(&result);
+  return result;
+}
+
+void streaming_json_readert::skip_value()
+{
+  value(nullptr);
+}
+
+void streaming_json_readert::end()
+{
+  if(peek() != EOF)
+    error("expected end of file");
+}
+
+void streaming_json_readert::value(jsont *dest)
+{
+  switch(peek_kind())
+  {
+  case jsont::kindt::J_OBJECT:
+  {
+    begin_object();
+    json_objectt object;
+    while(const auto key = next_key())
+    {
+      if(dest == nullptr)
+        value(nullptr);
+      else
+        value(&object[*key]);
+    }
+    if(dest != nullptr)
+      *dest = std::move(object);
+    break;
+  }
+
+  case jsont::kindt::J_ARRAY:
+  {
+    buffer.sbumpc();
+    json_arrayt array;
+    if(peek() == ']')
+      buffer.sbumpc();
+    else
+    {
+      do
+      {
+        value(dest == nullptr ? nullptr : &array.push_back());
+        if(peek() != ',')
+          break;
+        buffer.sbumpc();
+      } while(true);
+      expect(']');
+    }
+    if(dest != nullptr)
+      *dest = std::move(array);
+    break;
+  }
+
+  case jsont::kindt::J_STRING:
+  {
+    std::string result = string();
+    if(dest != nullptr)
+      *dest = json_stringt(std::move(result));
+    break;
+  }
+
+  case jsont::kindt::J_NUMBER:
+  {
+    std::string result = number();
+    if(dest != nullptr)
+      *dest = json_numbert(result);
+    break;
+  }
+
+  case jsont::kindt::J_TRUE:
+    literal("true");
+    if(dest != nullptr)
+      *dest = json_truet();
+    break;
+
+  case jsont::kindt::J_FALSE:
+    literal("false");
+    if(dest != nullptr)
+      *dest = json_falset();
+    break;
+
+  case jsont::kindt::J_NULL:
+    literal("null");
+    if(dest != nullptr)
+      *dest = json_nullt();
+    break;
+  }
+}
+
+std::string streaming_json_readert::string()
+{
+  buffer.sbumpc(); // the opening quote
+
+  std::string result;
+  while(true)
+  {
+    const int c = buffer.sbumpc();
+    if(c == EOF)
+      error("unterminated string");
+    else if(c == '"')
+      return result;
+    else if(c == '\n')
+      ++line;
+    else if(c == '\\')
+    {
+      const int escaped = buffer.sbumpc();
+      switch(escaped)
+      {
+      // clang-format off
+      case '"':  result += '"'; break;
+      case '\\': result += '\\'; break;
+      case '/':  result += '/'; break;
+      case 'b':  result += '\b'; break;
+      case 'f':  result += '\f'; break;
+      case 'n':  result += '\n'; break;
+      case 'r':  result += '\r'; break;
+      case 't':  result += '\t'; break;
+      // clang-format on
+      case 'u':
+      {
+        std::string hex;
+        for(int i = 0; i < 4; ++i)
+        {
+          const int digit = buffer.sbumpc();
+          if(digit == EOF || !isxdigit(digit))
+            error("invalid unicode escape sequence");
+          hex += static_cast<char>(digit);
+        }
+        result += codepoint_hex_to_utf8(hex);
+        break;
+      }
+      default:
+        error("invalid escape sequence");
+      }
+      continue;
+    }
+
+    result += static_cast<char>(c);
+  }
+}
+
+std::string streaming_json_readert::number()
+{
+  std::string result;
+
+  const auto digits = [this, &result]() {
+    if(!isdigit(buffer.sgetc()))
+      error("invalid number `" + result + "'");
+    while(isdigit(buffer.sgetc()))
+      result += static_cast<char>(buffer.sbumpc());
+  };
+
+  if(buffer.sgetc() == '-')
+    result += static_cast<char>(buffer.sbumpc());
+
+  // no leading zeros
+  if(buffer.sgetc() == '0')
+    result += static_cast<char>(buffer.sbumpc());
+  else
+    digits();
+
+  if(buffer.sgetc() == '.')
+  {
+    result += static_cast<char>(buffer.sbumpc());
+    digits();
+  }
+
+  if(buffer.sgetc() == 'e' || buffer.sgetc() == 'E')
+  {
+    result += static_cast<char>(buffer.sbumpc());
+    if(buffer.sgetc() == '+' || buffer.sgetc() == '-')
+      result += static_cast<char>(buffer.sbumpc());
+    digits();
+  }
+
+  return result;
+}
+
+void streaming_json_readert::literal(const char *text)
+{
+  for(const char *p = text; *p != 0; ++p)
+  {
+    if(buffer.sbumpc() != *p)
+      error(std::string("invalid literal, expected `") + text + "'");
+  }
+}
+
+void streaming_json_readert::error(const std::string &message) const
+{
+  throw deserialization_exceptiont(
+    filename + ":" + std::to_string(line) + ": " + message);
+}
@@ -0,0 +1,86 @@
+/*******************************************************************\
+
+Module: Streaming JSON Reader
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Streaming JSON Reader
+
+#ifndef CPROVER_JSON_STREAMING_JSON_READER_H
+#define CPROVER_JSON_STREAMING_JSON_READER_H
+
+#include <util/json.h>
+#include <util/optional.h>
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/// Reads a JSON document from a stream one value at a time, such that a
+/// document that consists of a large object or array need not be held in
+/// memory as a whole. The members of an object are visited with
+/// \ref begin_object and \ref next_key, and each of their values is either
+/// read into a \ref jsont, skipped, or visited in turn. The input is read
+/// through the buffer of the stream, without any look-ahead beyond the
+/// current character.
+///
+/// The accepted syntax is the one of \ref parse_json. Syntax errors are
+/// reported by throwing a \ref deserialization_exceptiont that gives the
+/// file name and line.
+class streaming_json_readert
+{
+public:
+  streaming_json_readert(std::istream &in, std::string filename);
+
+  /// \return the kind of the next value, without consuming any of it
+  jsont::kindt peek_kind();
+
+  /// Consume the `{` that starts an object, whose members are then visited
+  /// with \ref next_key
+  void begin_object();
+
+  /// Consume the key of the next member of the innermost object that has
+  /// been begun, and the `:` that follows it. The value of the member must
+  /// be consumed before the next call.
+  /// \return the key, or an empty optional if the object has ended, in which
+  ///   case its `}` has been consumed
+  optionalt<std::string> next_key();
+
+  /// \return the next value as a whole
+  jsont read_value();
+
+  /// Consume the next value, without building it
+  void skip_value();
+
+  /// Check that nothing but white space follows
+  void end();
+
+private:
+  std::streambuf &buffer;
+  const std::string filename;
+  std::size_t line = 1;
+
+  /// For each object that has been begun, whether a member has been read
+  std::vector<bool> objects;
+
+  /// \return the next character that is not white space, without consuming
+  ///   it, or EOF
+  int peek();
+
+  /// Consume the next character that is not white space, which must be \p c
+  void expect(char c);
+
+  /// Read a value, building it in \p dest unless that is null
+  void value(jsont *dest);
+
+  std::string string();
+  std::string number();
+  void literal(const char *text);
+
+  [[noreturn]] void error(const std::string &message) const;
+};
+
+#endif // CPROVER_JSON_STREAMING_JSON_READER_H
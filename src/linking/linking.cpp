@@ -27,6 +27,15 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "linking_class.h"
 
+/// \return true if \p type1 and \p type2 are the same. Their hashes, which
+///   are cached in the ireps such that a type in the main symbol table is
+///   hashed once however many symbol tables are linked into it, are compared
+///   first. Types that differ are thus rarely compared structurally.
+static bool same_type(const typet &type1, const typet &type2)
+{
+  return type1.hash() == type2.hash() && type1 == type2;
+}
+
 bool casting_replace_symbolt::replace_symbol_expr(symbol_exprt &s) const
 {
   expr_mapt::const_iterator it = expr_map.find(s.get_identifier());
@@ -1148,7 +1157,7 @@ void linkingt::duplicate_type_symbol(
     return;
   }
 
-  if(old_symbol.type==new_symbol.type)
+  if(same_type(old_symbol.type, new_symbol.type))
     return;
 
   if(
@@ -1237,7 +1246,7 @@ bool linkingt::needs_renaming_type(
   if(!old_symbol.is_type)
     return true;
 
-  if(old_symbol.type==new_symbol.type)
+  if(same_type(old_symbol.type, new_symbol.type))
     return false;
 
   if(
@@ -1293,6 +1302,9 @@ void linkingt::do_type_dependencies(
   // Any type that uses a symbol that will be renamed also
   // needs to be renamed, and so on, until saturation.
 
+  if(needs_to_be_renamed.empty())
+    return;
+
   used_byt used_by;
 
   for(const auto &symbol_pair : src_symbol_table.symbols)
@@ -1372,11 +1384,27 @@ void linkingt::copy_symbols(
   // First apply the renaming
   for(const auto &named_symbol : src_symbol_table.symbols)
   {
+    auto it = new_identifiers.find(named_symbol.first);
+
+    // An identical definition of a type, e.g. of a struct declared in a
+    // header that several files include, is kept as it is in the main
+    // symbol table. As the type does not need to be renamed, neither does
+    // any symbol that it uses.
+    if(named_symbol.second.is_type && it == new_identifiers.end())
+    {
+      const symbolt *old_symbol = main_symbol_table.lookup(named_symbol.first);
+      if(
+        old_symbol != nullptr && old_symbol->is_type &&
+        same_type(old_symbol->type, named_symbol.second.type))
+      {
+        continue;
+      }
+    }
+
     symbolt symbol=named_symbol.second;
     // apply the renaming
     rename_symbol(symbol.type);
     rename_symbol(symbol.value);
-    auto it = new_identifiers.find(named_symbol.first);
     if(it != new_identifiers.end())
       symbol.name = it->second;
 
@@ -1418,7 +1446,11 @@ void linkingt::copy_symbols(
       duplicate_non_type_symbol(old_symbol, new_symbol);
   }
 
-  // Apply type updates to initializers
+  // Apply type updates to initializers, which is only needed when the type
+  // of an object has been adjusted, e.g. by completing an array type
+  if(object_type_updates.empty())
+    return;
+
   for(const auto &named_symbol : main_symbol_table.symbols)
   {
     if(!named_symbol.second.is_type &&
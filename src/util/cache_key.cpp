@@ -0,0 +1,45 @@
+/*******************************************************************\
+
+Module: Keys of Cache Entries
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Keys of cache entries
+
+#include "cache_key.h"
+
+#include "exception_utils.h"
+#include "irep_serialization.h"
+
+#include <istream>
+#include <ostream>
+
+void write_cache_key(std::ostream &out, const std::string &key)
+{
+  write_gb_word(out, key.size());
+  out.write(key.data(), static_cast<std::streamsize>(key.size()));
+}
+
+bool read_cache_key(std::istream &in, const std::string &key)
+{
+  std::size_t size;
+  try
+  {
+    size = irep_serializationt::read_gb_word(in);
+  }
+  catch(const deserialization_exceptiont &)
+  {
+    return true;
+  }
+
+  if(size != key.size())
+    return true;
+
+  std::string stored(size, 0);
+  in.read(&stored[0], static_cast<std::streamsize>(size));
+
+  return !in || stored != key;
+}
@@ -0,0 +1,27 @@
+/*******************************************************************\
+
+Module: Keys of Cache Entries
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Keys of cache entries, which are kept in the entries themselves, such that
+/// an entry whose file name collides with that of another key is not used
+
+#ifndef CPROVER_UTIL_CACHE_KEY_H
+#define CPROVER_UTIL_CACHE_KEY_H
+
+#include <iosfwd>
+#include <string>
+
+/// Write \p key to \p out, to be checked by \ref read_cache_key
+void write_cache_key(std::ostream &out, const std::string &key);
+
+/// Read the key that \ref write_cache_key wrote to \p in and compare it to
+/// \p key
+/// \return true if the key cannot be read or is not \p key, false otherwise
+bool read_cache_key(std::istream &in, const std::string &key);
+
+#endif // CPROVER_UTIL_CACHE_KEY_H
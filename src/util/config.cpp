@@ -10,6 +10,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <climits>
 #include <cstdlib>
+#include <sstream>
 
 #include "arith_tools.h"
 #include "cmdline.h"
@@ -1084,6 +1085,12 @@ bool configt::set(const cmdlinet &cmdline)
   if(cmdline.isset("no-library"))
     ansi_c.lib=configt::ansi_ct::libt::LIB_NONE;
 
+  if(cmdline.isset("library-cache"))
+    ansi_c.library_cache = cmdline.get_value("library-cache");
+
+  if(cmdline.isset("precompiled-headers"))
+    ansi_c.precompiled_headers = cmdline.get_value("precompiled-headers");
+
   if(cmdline.isset("little-endian"))
     ansi_c.endianness=configt::ansi_ct::endiannesst::IS_LITTLE_ENDIAN;
 
@@ -1187,6 +1194,35 @@ std::string configt::ansi_ct::os_to_string(ost os)
   UNREACHABLE;
 }
 
+std::string configt::ansi_ct::typecheck_settings() const
+{
+  std::ostringstream out;
+
+  out << arch << ' ' << os_to_string(os) << ' ' << static_cast<int>(mode)
+      << ' ' << static_cast<int>(preprocessor) << ' '
+      << static_cast<int>(c_standard) << '\n'
+      << bool_width << ' ' << char_width << ' ' << short_int_width << ' '
+      << int_width << ' ' << long_int_width << ' ' << long_long_int_width
+      << ' ' << pointer_width << ' ' << single_width << ' ' << double_width
+      << ' ' << long_double_width << ' ' << wchar_t_width << ' ' << alignment
+      << ' ' << memory_operand_size << '\n'
+      << static_cast<int>(endianness) << ' ' << char_is_unsigned << ' '
+      << wchar_t_is_unsigned << ' ' << for_has_scope << ' '
+      << ts_18661_3_Floatn_types << ' ' << gcc__float128_type << ' '
+      << single_precision_constant << ' ' << NULL_is_zero << ' '
+      << static_cast<int>(rounding_mode) << '\n';
+
+  for(const auto &list :
+      {defines, undefines, preprocessor_options, include_paths, include_files})
+  {
+    for(const auto &entry : list)
+      out << entry << '\n';
+    out << '\n';
+  }
+
+  return out.str();
+}
+
 configt::ansi_ct::ost configt::ansi_ct::string_to_os(const std::string &os)
 {
   if(os=="linux")
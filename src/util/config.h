@@ -58,11 +58,13 @@ class symbol_tablet;
 #define OPT_CONFIG_LIBRARY                                                     \
   "(malloc-fail-assert)(malloc-fail-null)(malloc-may-fail)"                    \
   "(string-abstraction)"                                                       \
+  "(library-cache):"                                                           \
 
 #define HELP_CONFIG_LIBRARY                                                    \
 " --malloc-may-fail            allow malloc calls to return a null pointer\n"  \
 " --malloc-fail-assert         set malloc failure mode to assert-then-assume\n"\
 " --malloc-fail-null           set malloc failure mode to return null\n"       \
+" --library-cache dir          keep the typechecked library in dir\n"          \
 
 
 #define OPT_CONFIG_JAVA                                                        \
@@ -245,6 +247,19 @@ class configt
     };
     libt lib;
 
+    /// Directory in which the typechecked models of the library are kept
+    /// between runs, or empty if they are not cached
+    std::string library_cache;
+
+    /// Directory in which the typechecked headers that translation units
+    /// start with are kept between runs, or empty if they are not
+    std::string precompiled_headers;
+
+    /// \return a description of the settings that the result of type
+    ///   checking depends on, for use in the keys of caches of type-checked
+    ///   files
+    std::string typecheck_settings() const;
+
     bool string_abstraction;
     bool malloc_may_fail = false;
 
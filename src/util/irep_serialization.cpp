@@ -18,6 +18,40 @@ Date: May 2007
 
 #include "exception_utils.h"
 
+// Bytes are read and written through the buffer of the stream, as the
+// unformatted input and output functions of the stream construct a sentry
+// for each byte.
+
+static void write_byte(std::ostream &out, char c)
+{
+  if(out.good() && out.rdbuf()->sputc(c) == std::char_traits<char>::eof())
+    out.setstate(std::ios::badbit);
+}
+
+static void write_bytes(std::ostream &out, const char *data, std::size_t size)
+{
+  if(
+    out.good() &&
+    out.rdbuf()->sputn(data, static_cast<std::streamsize>(size)) !=
+      static_cast<std::streamsize>(size))
+  {
+    out.setstate(std::ios::badbit);
+  }
+}
+
+/// \return the next byte of \p in, which is removed from \p in
+static char read_byte(std::istream &in)
+{
+  const int c = in.rdbuf()->sbumpc();
+  if(c == std::char_traits<char>::eof())
+  {
+    in.setstate(std::ios::eofbit | std::ios::failbit);
+    throw deserialization_exceptiont("unexpected end of input stream");
+  }
+
+  return static_cast<char>(c);
+}
+
 void irep_serializationt::write_irep(
   std::ostream &out,
   const irept &irep)
@@ -26,24 +60,40 @@ void irep_serializationt::write_irep(
 
   for(const auto &sub_irep : irep.get_sub())
   {
-    out.put('S');
+    write_byte(out, 'S');
     reference_convert(sub_irep, out);
   }
 
   for(const auto &sub_irep_entry : irep.get_named_sub())
   {
-    out.put('N');
+    write_byte(out, 'N');
     write_string_ref(out, sub_irep_entry.first);
     reference_convert(sub_irep_entry.second, out);
   }
 
-  out.put(0); // terminator
+  write_byte(out, 0); // terminator
 }
 
 const irept &irep_serializationt::reference_convert(std::istream &in)
 {
   std::size_t id=read_gb_word(in);
 
+  if(shared != nullptr)
+  {
+    if(id < shared_ireps)
+    {
+      if(
+        id >= shared->ireps_on_read.size() || !shared->ireps_on_read[id].first)
+      {
+        throw deserialization_exceptiont("unknown shared irep");
+      }
+
+      return shared->ireps_on_read[id].second;
+    }
+
+    id -= shared_ireps;
+  }
+
   if(
     id >= ireps_container.ireps_on_read.size() ||
     !ireps_container.ireps_on_read[id].first)
@@ -65,22 +115,24 @@ const irept &irep_serializationt::reference_convert(std::istream &in)
 
 irept irep_serializationt::read_irep(std::istream &in)
 {
+  std::streambuf &buffer = *in.rdbuf();
+
   irep_idt id = read_string_ref(in);
   irept::subt sub;
   irept::named_subt named_sub;
 
-  while(in.peek()=='S')
+  while(buffer.sgetc() == 'S')
   {
-    in.get();
+    buffer.sbumpc();
     sub.push_back(reference_convert(in));
   }
 
 #if NAMED_SUB_IS_FORWARD_LIST
   irept::named_subt::iterator before = named_sub.before_begin();
 #endif
-  while(in.peek()=='N')
+  while(buffer.sgetc() == 'N')
   {
-    in.get();
+    buffer.sbumpc();
     irep_idt id = read_string_ref(in);
 #if NAMED_SUB_IS_FORWARD_LIST
     named_sub.emplace_after(before, id, reference_convert(in));
@@ -90,9 +142,9 @@ irept irep_serializationt::read_irep(std::istream &in)
 #endif
   }
 
-  while(in.peek()=='C')
+  while(buffer.sgetc() == 'C')
   {
-    in.get();
+    buffer.sbumpc();
     irep_idt id = read_string_ref(in);
 #if NAMED_SUB_IS_FORWARD_LIST
     named_sub.emplace_after(before, id, reference_convert(in));
@@ -102,7 +154,7 @@ irept irep_serializationt::read_irep(std::istream &in)
 #endif
   }
 
-  if(in.get()!=0)
+  if(read_byte(in) != 0)
   {
     throw deserialization_exceptiont("irep not terminated");
   }
@@ -117,6 +169,27 @@ void irep_serializationt::reference_convert(
   const irept &irep,
   std::ostream &out)
 {
+  if(shared != nullptr)
+  {
+    // the hashes must be numbered consistently with the shared ireps
+    std::size_t h = shared->irep_full_hash_container.number(irep);
+
+    const auto entry = shared->ireps_on_write.find(h);
+    if(entry != shared->ireps_on_write.end())
+    {
+      write_gb_word(out, entry->second);
+      return;
+    }
+
+    const auto res = ireps_container.ireps_on_write.insert(
+      {h, shared_ireps + ireps_container.ireps_on_write.size()});
+
+    write_gb_word(out, res.first->second);
+    if(res.second)
+      write_irep(out, irep);
+    return;
+  }
+
   std::size_t h=ireps_container.irep_full_hash_container.number(irep);
 
   const auto res = ireps_container.ireps_on_write.insert(
@@ -133,6 +206,8 @@ void irep_serializationt::reference_convert(
 /// \param u: number to write
 void write_gb_word(std::ostream &out, std::size_t u)
 {
+  char bytes[(sizeof(u) * CHAR_BIT + 6) / 7];
+  std::size_t size = 0;
 
   while(true)
   {
@@ -141,12 +216,14 @@ void write_gb_word(std::ostream &out, std::size_t u)
 
     if(u==0)
     {
-      out.put(value);
+      bytes[size++] = static_cast<char>(value);
       break;
     }
 
-    out.put(value | 0x80);
+    bytes[size++] = static_cast<char>(value | 0x80);
   }
+
+  write_bytes(out, bytes, size);
 }
 
 /// Interpret a stream of byte as a 7-bit encoded unsigned number.
@@ -154,26 +231,21 @@ void write_gb_word(std::ostream &out, std::size_t u)
 /// \return decoded number
 std::size_t irep_serializationt::read_gb_word(std::istream &in)
 {
-  std::size_t res=0;
+  if(!in.good())
+    throw deserialization_exceptiont("unexpected end of input stream");
 
-  unsigned shift_distance=0;
+  std::size_t res=0;
 
-  while(in.good())
+  for(unsigned shift_distance = 0;; shift_distance += 7)
   {
     if(shift_distance >= sizeof(res) * CHAR_BIT)
       throw deserialization_exceptiont("input number too large");
 
-    unsigned char ch=static_cast<unsigned char>(in.get());
+    const unsigned char ch = static_cast<unsigned char>(read_byte(in));
     res|=(size_t(ch&0x7f))<<shift_distance;
-    shift_distance+=7;
     if((ch&0x80)==0)
-      break;
+      return res;
   }
-
-  if(!in.good())
-    throw deserialization_exceptiont("unexpected end of input stream");
-
-  return res;
 }
 
 /// outputs the string and then a zero byte.
@@ -181,16 +253,20 @@ std::size_t irep_serializationt::read_gb_word(std::istream &in)
 /// \param s: string to output
 void write_gb_string(std::ostream &out, const std::string &s)
 {
-  for(std::string::const_iterator it=s.begin();
-      it!=s.end();
-      ++it)
+  // write the characters between specials at once
+  std::size_t begin = 0;
+  for(std::size_t i = 0; i < s.size(); ++i)
   {
-    if(*it==0 || *it=='\\')
-      out.put('\\'); // escape specials
-    out << *it;
+    if(s[i] == 0 || s[i] == '\\')
+    {
+      write_bytes(out, s.data() + begin, i - begin);
+      write_byte(out, '\\'); // escape specials
+      begin = i;
+    }
   }
 
-  out.put(0);
+  write_bytes(out, s.data() + begin, s.size() - begin);
+  write_byte(out, 0);
 }
 
 /// reads a string from the stream
@@ -201,13 +277,13 @@ irep_idt irep_serializationt::read_gb_string(std::istream &in)
   char c;
   size_t length=0;
 
-  while((c=static_cast<char>(in.get()))!=0)
+  while((c = read_byte(in)) != 0)
   {
     if(length>=read_buffer.size())
       read_buffer.resize(read_buffer.size()*2, 0);
 
     if(c=='\\') // escaped chars
-      read_buffer[length]=static_cast<char>(in.get());
+      read_buffer[length] = read_byte(in);
     else
       read_buffer[length]=c;
 
@@ -225,6 +301,26 @@ void irep_serializationt::write_string_ref(
   const irep_idt &s)
 {
   size_t id=irep_id_hash()(s);
+
+  if(shared != nullptr)
+  {
+    if(id < shared->string_map.size() && shared->string_map[id])
+    {
+      write_gb_word(out, id);
+      return;
+    }
+
+    // strings that are not shared are numbered from shared_strings on, such
+    // that they can be looked up without allocating a map of all strings
+    const auto res = ireps_container.string_refs_on_write.insert(
+      {id, shared_strings + ireps_container.string_refs_on_write.size()});
+
+    write_gb_word(out, res.first->second);
+    if(res.second)
+      write_gb_string(out, id2string(s));
+    return;
+  }
+
   if(id>=ireps_container.string_map.size())
     ireps_container.string_map.resize(id+1, false);
 
@@ -245,6 +341,23 @@ irep_idt irep_serializationt::read_string_ref(std::istream &in)
 {
   std::size_t id=read_gb_word(in);
 
+  if(shared != nullptr)
+  {
+    if(id < shared_strings)
+    {
+      if(
+        id >= shared->string_rev_map.size() ||
+        !shared->string_rev_map[id].first)
+      {
+        throw deserialization_exceptiont("unknown shared string");
+      }
+
+      return shared->string_rev_map[id].second;
+    }
+
+    id -= shared_strings;
+  }
+
   if(id>=ireps_container.string_rev_map.size())
     ireps_container.string_rev_map.resize(1+id*2,
       std::pair<bool, irep_idt>(false, irep_idt()));
@@ -17,6 +17,7 @@ Date: May 2007
 #include <map>
 #include <iosfwd>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "irep_hash_container.h"
@@ -44,6 +45,11 @@ class irep_serializationt
     typedef std::vector<std::pair<bool, irep_idt> > string_rev_mapt;
     string_rev_mapt string_rev_map;
 
+    /// The references of the strings written relative to a shared container,
+    /// by the number of the string in the string table
+    typedef std::unordered_map<std::size_t, std::size_t> string_refs_on_writet;
+    string_refs_on_writet string_refs_on_write;
+
     void clear()
     {
       irep_full_hash_container.clear();
@@ -51,6 +57,7 @@ class irep_serializationt
       ireps_on_read.clear();
       string_map.clear();
       string_rev_map.clear();
+      string_refs_on_write.clear();
     }
   };
 
@@ -61,6 +68,31 @@ class irep_serializationt
     clear();
   };
 
+  /// Serialize relative to the ireps and strings that \p shared has written
+  /// or read, such that the result refers to those rather than repeating
+  /// them. The result can thus be read using only \p shared, independently
+  /// of any other stream that was written relative to \p shared.
+  /// \param ic: the ireps and strings that are not in \p shared
+  /// \param shared: the ireps and strings that are shared, of which only the
+  ///   hash container is modified
+  /// \param shared_ireps: the number of ireps in \p shared, i.e. the first
+  ///   reference of an irep that is not shared
+  /// \param shared_strings: the first reference of a string that is not
+  ///   shared
+  irep_serializationt(
+    ireps_containert &ic,
+    ireps_containert &shared,
+    std::size_t shared_ireps,
+    std::size_t shared_strings)
+    : ireps_container(ic),
+      shared(&shared),
+      shared_ireps(shared_ireps),
+      shared_strings(shared_strings)
+  {
+    read_buffer.resize(1, 0);
+    clear();
+  }
+
   const irept &reference_convert(std::istream &);
   void reference_convert(const irept &irep, std::ostream &);
 
@@ -76,6 +108,10 @@ class irep_serializationt
   ireps_containert &ireps_container;
   std::vector<char> read_buffer;
 
+  ireps_containert *shared = nullptr;
+  std::size_t shared_ireps = 0;
+  std::size_t shared_strings = 0;
+
   void write_irep(std::ostream &, const irept &irep);
   irept read_irep(std::istream &);
 };
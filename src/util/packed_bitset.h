@@ -0,0 +1,345 @@
+/*******************************************************************\
+
+Module: Packed Bit Sets
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Sets of natural numbers stored as packed bitvectors
+
+#ifndef CPROVER_UTIL_PACKED_BITSET_H
+#define CPROVER_UTIL_PACKED_BITSET_H
+
+#include "invariant.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+/// A set of natural numbers, stored as a bitvector that is packed into 64-bit
+/// words. Only the non-zero words are stored, together with their index and
+/// sorted by it, so a set of large numbers that are close to each other is
+/// compact even when the numbers are drawn from a large universe. Union and
+/// difference work a word at a time. Iteration yields the elements in
+/// ascending order, like a `std::set<std::size_t>`.
+class packed_bitsett
+{
+public:
+  typedef std::uint64_t wordt;
+  static const std::size_t bits_per_word = 64;
+
+  /// Iterates over the elements of the set in ascending order
+  class const_iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef std::size_t value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const std::size_t *pointer;
+    typedef const std::size_t &reference;
+
+    reference operator*() const
+    {
+      return current;
+    }
+
+    pointer operator->() const
+    {
+      return &current;
+    }
+
+    const_iterator &operator++()
+    {
+      remaining &= remaining - 1;
+      if(remaining == 0)
+      {
+        ++word;
+        load();
+      }
+      else
+        current = word->first * bits_per_word + lowest_bit(remaining);
+      return *this;
+    }
+
+    const_iterator operator++(int)
+    {
+      const_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const const_iterator &other) const
+    {
+      return word == other.word && remaining == other.remaining;
+    }
+
+    bool operator!=(const const_iterator &other) const
+    {
+      return !(*this == other);
+    }
+
+  private:
+    friend class packed_bitsett;
+
+    typedef std::vector<std::pair<std::size_t, wordt>>::const_iterator
+      word_iteratort;
+
+    const_iterator(word_iteratort word, word_iteratort end)
+      : word(word), end(end), remaining(0), current(0)
+    {
+      load();
+    }
+
+    void load()
+    {
+      if(word == end)
+      {
+        remaining = 0;
+        return;
+      }
+
+      remaining = word->second;
+      current = word->first * bits_per_word + lowest_bit(remaining);
+    }
+
+    word_iteratort word;
+    word_iteratort end;
+    /// The bits of the current word that have not been visited yet
+    wordt remaining;
+    std::size_t current;
+  };
+
+  const_iterator begin() const
+  {
+    return const_iterator(words.begin(), words.end());
+  }
+
+  const_iterator end() const
+  {
+    return const_iterator(words.end(), words.end());
+  }
+
+  bool empty() const
+  {
+    return words.empty();
+  }
+
+  std::size_t size() const
+  {
+    std::size_t result = 0;
+    for(const auto &w : words)
+    {
+      for(wordt bits = w.second; bits != 0; bits &= bits - 1)
+        ++result;
+    }
+    return result;
+  }
+
+  void clear()
+  {
+    words.clear();
+  }
+
+  bool contains(std::size_t value) const
+  {
+    const auto it = find_word(value / bits_per_word);
+    return it != words.end() && it->first == value / bits_per_word &&
+           (it->second & bit(value)) != 0;
+  }
+
+  /// \return true if \p value was not an element of the set before
+  bool insert(std::size_t value)
+  {
+    const std::size_t index = value / bits_per_word;
+    auto it = find_word(index);
+
+    if(it == words.end() || it->first != index)
+    {
+      words.insert(it, std::make_pair(index, bit(value)));
+      return true;
+    }
+
+    if((it->second & bit(value)) != 0)
+      return false;
+
+    it->second |= bit(value);
+    return true;
+  }
+
+  /// \return true if \p value was an element of the set before
+  bool erase(std::size_t value)
+  {
+    const std::size_t index = value / bits_per_word;
+    auto it = find_word(index);
+
+    if(
+      it == words.end() || it->first != index ||
+      (it->second & bit(value)) == 0)
+    {
+      return false;
+    }
+
+    it->second &= ~bit(value);
+    if(it->second == 0)
+      words.erase(it);
+    return true;
+  }
+
+  /// Add all elements of \p other to this set
+  /// \return true if this set has changed
+  bool insert(const packed_bitsett &other)
+  {
+    if(other.words.empty())
+      return false;
+
+    if(words.empty())
+    {
+      words = other.words;
+      return true;
+    }
+
+    // Check for new words first to avoid reallocation in the common case that
+    // the word indices of \p other are a subset of the ones of this set
+    bool changed = false;
+    bool new_words = false;
+    auto it = words.begin();
+    for(const auto &w : other.words)
+    {
+      while(it != words.end() && it->first < w.first)
+        ++it;
+      if(it == words.end() || it->first != w.first)
+      {
+        new_words = true;
+        break;
+      }
+
+      if((w.second & ~it->second) != 0)
+      {
+        it->second |= w.second;
+        changed = true;
+      }
+    }
+
+    if(!new_words)
+      return changed;
+
+    std::vector<std::pair<std::size_t, wordt>> result;
+    result.reserve(words.size() + other.words.size());
+
+    auto a = words.begin();
+    auto b = other.words.begin();
+    while(a != words.end() || b != other.words.end())
+    {
+      if(b == other.words.end() || (a != words.end() && a->first < b->first))
+        result.push_back(*a++);
+      else if(a == words.end() || b->first < a->first)
+        result.push_back(*b++);
+      else
+      {
+        result.emplace_back(a->first, a->second | b->second);
+        ++a;
+        ++b;
+      }
+    }
+
+    words.swap(result);
+    return true;
+  }
+
+  /// Remove all elements of \p other from this set
+  /// \return true if this set has changed
+  bool erase(const packed_bitsett &other)
+  {
+    bool changed = false;
+    auto it = words.begin();
+    for(const auto &w : other.words)
+    {
+      while(it != words.end() && it->first < w.first)
+        ++it;
+      if(it == words.end())
+        break;
+      if(it->first == w.first && (it->second & w.second) != 0)
+      {
+        it->second &= ~w.second;
+        changed = true;
+      }
+    }
+
+    if(changed)
+    {
+      words.erase(
+        std::remove_if(
+          words.begin(),
+          words.end(),
+          [](const std::pair<std::size_t, wordt> &w) { return w.second == 0; }),
+        words.end());
+    }
+
+    return changed;
+  }
+
+  bool operator==(const packed_bitsett &other) const
+  {
+    return words == other.words;
+  }
+
+  bool operator!=(const packed_bitsett &other) const
+  {
+    return words != other.words;
+  }
+
+protected:
+  /// Pairs of word index and (non-zero) word, sorted by index
+  std::vector<std::pair<std::size_t, wordt>> words;
+
+  static wordt bit(std::size_t value)
+  {
+    return wordt(1) << (value % bits_per_word);
+  }
+
+  static std::size_t lowest_bit(wordt bits)
+  {
+    PRECONDITION(bits != 0);
+#ifdef __GNUC__
+    return static_cast<std::size_t>(__builtin_ctzll(bits));
+#else
+    std::size_t result = 0;
+    while((bits & 1) == 0)
+    {
+      bits >>= 1;
+      ++result;
+    }
+    return result;
+#endif
+  }
+
+  std::vector<std::pair<std::size_t, wordt>>::iterator
+  find_word(std::size_t index)
+  {
+    return std::lower_bound(
+      words.begin(),
+      words.end(),
+      index,
+      [](const std::pair<std::size_t, wordt> &w, std::size_t i) {
+        return w.first < i;
+      });
+  }
+
+  std::vector<std::pair<std::size_t, wordt>>::const_iterator
+  find_word(std::size_t index) const
+  {
+    return std::lower_bound(
+      words.begin(),
+      words.end(),
+      index,
+      [](const std::pair<std::size_t, wordt> &w, std::size_t i) {
+        return w.first < i;
+      });
+  }
+};
+
+#endif // CPROVER_UTIL_PACKED_BITSET_H
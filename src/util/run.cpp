@@ -405,7 +405,7 @@ int run(
           continue; // try again
         else
         {
-          unregister_child();
+          unregister_child(childpid);
 
           perror("Waiting for child process failed");
           if(stdin_fd!=STDIN_FILENO)
@@ -418,7 +418,7 @@ int run(
         }
       }
 
-      unregister_child();
+      unregister_child(childpid);
 
       if(stdin_fd!=STDIN_FILENO)
         close(stdin_fd);
@@ -13,27 +13,47 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #if defined(_WIN32)
 #else
+#include <array>
+#include <atomic>
 #include <cstdlib>
 #endif
 
 // Here we have an instance of an ugly global object.
 // It keeps track of any child processes that we'll kill
 // when we are told to terminate. "No child" is indicated by '0'.
+// The slots are atomic as several children may be registered and
+// unregistered concurrently, and as the signal handler reads them.
 
 #ifdef _WIN32
 #else
-pid_t child_pid = 0;
+static std::array<std::atomic<pid_t>, max_registered_children> child_pids;
 
 void register_child(pid_t pid)
 {
-  PRECONDITION(child_pid == 0);
-  child_pid = pid;
+  PRECONDITION(pid != 0);
+
+  for(auto &child_pid : child_pids)
+  {
+    pid_t no_child = 0;
+    if(child_pid.compare_exchange_strong(no_child, pid))
+      return;
+  }
+
+  INVARIANT(false, "at most max_registered_children can be registered");
 }
 
-void unregister_child()
+void unregister_child(pid_t pid)
 {
-  PRECONDITION(child_pid != 0);
-  child_pid = 0;
+  PRECONDITION(pid != 0);
+
+  for(auto &child_pid : child_pids)
+  {
+    pid_t registered = pid;
+    if(child_pid.compare_exchange_strong(registered, 0))
+      return;
+  }
+
+  UNREACHABLE;
 }
 #endif
 
@@ -80,9 +100,13 @@ void signal_catcher(int sig)
   // kill any children by killing group
   killpg(0, sig);
 #else
-  // pass on to our child, if any
-  if(child_pid != 0)
-    kill(child_pid, sig);
+  // pass on to our children, if any
+  for(const auto &child_pid : child_pids)
+  {
+    const pid_t pid = child_pid.load();
+    if(pid != 0)
+      kill(pid, sig);
+  }
 #endif
 
   exit(sig); // should contemplate something from sysexits.h
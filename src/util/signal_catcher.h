@@ -16,8 +16,15 @@ void signal_catcher(int sig);
 
 #ifndef _WIN32
 #include <csignal>
+#include <cstddef>
+
+/// The number of child processes that can be registered at the same time
+const std::size_t max_registered_children = 256;
+
+/// Register a child process that is to be terminated together with this
+/// process. Registering and unregistering is safe from several threads.
 void register_child(pid_t);
-void unregister_child();
+void unregister_child(pid_t);
 #endif
 
 #endif // CPROVER_UTIL_SIGNAL_CATCHER_H
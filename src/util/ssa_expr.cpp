@@ -48,61 +48,72 @@ ssa_exprt::ssa_exprt(const exprt &expr) : symbol_exprt(expr.type())
   set(ID_L1_object_identifier, id);
 }
 
-/// If \p expr is a symbol "s" add to \p os "s!l0@l1#l2" and to \p l1_object_os
-/// "s!l0@l1".
+/// If \p expr is a symbol "s" append to \p id "s!l0@l1#l2" and to
+/// \p l1_object_id "s!l0@l1".
 /// If \p expr is a member or index expression, recursively apply the procedure
-/// and add "..component_name" or "[[index]]" to \p os.
+/// and append "..component_name" or "[[index]]" to \p id and \p l1_object_id.
 static void build_ssa_identifier_rec(
   const exprt &expr,
   const irep_idt &l0,
   const irep_idt &l1,
   const irep_idt &l2,
-  std::ostream &os,
-  std::ostream &l1_object_os)
+  std::string &id,
+  std::string &l1_object_id)
 {
   if(expr.id()==ID_member)
   {
     const member_exprt &member=to_member_expr(expr);
 
-    build_ssa_identifier_rec(member.struct_op(), l0, l1, l2, os, l1_object_os);
+    build_ssa_identifier_rec(member.struct_op(), l0, l1, l2, id, l1_object_id);
 
-    os << ".." << member.get_component_name();
-    l1_object_os << ".." << member.get_component_name();
+    const std::string &component_name =
+      id2string(member.get_component_name());
+    id += "..";
+    id += component_name;
+    l1_object_id += "..";
+    l1_object_id += component_name;
   }
   else if(expr.id()==ID_index)
   {
     const index_exprt &index=to_index_expr(expr);
 
-    build_ssa_identifier_rec(index.array(), l0, l1, l2, os, l1_object_os);
+    build_ssa_identifier_rec(index.array(), l0, l1, l2, id, l1_object_id);
 
-    const irep_idt &idx = to_constant_expr(index.index()).get_value();
-    os << "[[" << idx << "]]";
-    l1_object_os << "[[" << idx << "]]";
+    const std::string &idx =
+      id2string(to_constant_expr(index.index()).get_value());
+    id += "[[";
+    id += idx;
+    id += "]]";
+    l1_object_id += "[[";
+    l1_object_id += idx;
+    l1_object_id += "]]";
   }
   else if(expr.id()==ID_symbol)
   {
-    auto symid=to_symbol_expr(expr).get_identifier();
-    os << symid;
-    l1_object_os << symid;
+    // the symbol is the root object, hence both identifiers are still empty
+    l1_object_id = id2string(to_symbol_expr(expr).get_identifier());
 
     if(!l0.empty())
     {
       // Distinguish different threads of execution
-      os << '!' << l0;
-      l1_object_os << '!' << l0;
+      l1_object_id += '!';
+      l1_object_id += id2string(l0);
     }
 
     if(!l1.empty())
     {
       // Distinguish different calls to the same function (~stack frame)
-      os << '@' << l1;
-      l1_object_os << '@' << l1;
+      l1_object_id += '@';
+      l1_object_id += id2string(l1);
     }
 
+    id = l1_object_id;
+
     if(!l2.empty())
     {
       // Distinguish SSA steps for the same variable
-      os << '#' << l2;
+      id += '#';
+      id += id2string(l2);
     }
   }
   else
@@ -115,12 +126,14 @@ static std::pair<irep_idt, irep_idt> build_identifier(
   const irep_idt &l1,
   const irep_idt &l2)
 {
-  std::ostringstream oss;
-  std::ostringstream l1_object_oss;
+  // Identifiers are built for every renaming step of symbolic execution; plain
+  // string concatenation is considerably faster than using a string stream.
+  std::string id;
+  std::string l1_object_id;
 
-  build_ssa_identifier_rec(expr, l0, l1, l2, oss, l1_object_oss);
+  build_ssa_identifier_rec(expr, l0, l1, l2, id, l1_object_id);
 
-  return std::make_pair(irep_idt(oss.str()), irep_idt(l1_object_oss.str()));
+  return std::make_pair(irep_idt(id), irep_idt(l1_object_id));
 }
 
 static void update_identifier(ssa_exprt &ssa)
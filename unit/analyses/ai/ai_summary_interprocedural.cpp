@@ -0,0 +1,145 @@
+/*******************************************************************\
+
+Module: Unit tests for ai_summary_interproceduralt
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for ai_summary_interproceduralt
+
+#include <testing-utils/use_catch.h>
+
+#include <analyses/ai_summary_interprocedural.h>
+
+#include <goto-programs/goto_model.h>
+
+#include <util/message.h>
+#include <util/std_code.h>
+
+#include <set>
+
+/// A domain that records the location that the last function call returned
+/// to. Calls reset it, so that every call to a function has the same input.
+class return_site_domaint : public ai_domain_baset
+{
+public:
+  bool bottom = true;
+  std::set<unsigned> return_sites;
+
+  void transform(
+    const irep_idt &,
+    trace_ptrt from,
+    const irep_idt &,
+    trace_ptrt to,
+    ai_baset &,
+    const namespacet &) override
+  {
+    if(from->current_location()->is_function_call())
+      return_sites.clear();
+    else if(from->current_location()->is_end_function())
+      return_sites = {to->current_location()->location_number};
+  }
+
+  void make_bottom() override
+  {
+    bottom = true;
+    return_sites.clear();
+  }
+  void make_top() override
+  {
+    UNREACHABLE;
+  }
+  void make_entry() override
+  {
+    bottom = false;
+    return_sites.clear();
+  }
+  bool is_bottom() const override
+  {
+    return bottom;
+  }
+  bool is_top() const override
+  {
+    return false;
+  }
+
+  bool merge(const return_site_domaint &b, trace_ptrt, trace_ptrt)
+  {
+    if(b.bottom)
+      return false;
+
+    const bool was_bottom = bottom;
+    const std::size_t size = return_sites.size();
+    bottom = false;
+    return_sites.insert(b.return_sites.begin(), b.return_sites.end());
+    return was_bottom || return_sites.size() != size;
+  }
+};
+
+static void add_function(
+  goto_modelt &goto_model,
+  const irep_idt &name,
+  const std::vector<irep_idt> &callees)
+{
+  symbolt symbol;
+  symbol.name = name;
+  symbol.base_name = name;
+  symbol.mode = ID_C;
+  symbol.type = code_typet({}, empty_typet());
+  goto_model.symbol_table.add(symbol);
+
+  goto_programt &body = goto_model.goto_functions.function_map[name].body;
+  for(const auto &callee : callees)
+  {
+    const symbol_exprt function{callee, code_typet({}, empty_typet())};
+    body.add(goto_programt::make_function_call(code_function_callt{function}));
+  }
+  body.add(goto_programt::make_skip());
+  body.add(goto_programt::make_end_function());
+}
+
+SCENARIO(
+  "ai_summary_interproceduralt applies the return edge at each call site",
+  "[core][analyses][ai][ai_summary_interprocedural]")
+{
+  // __CPROVER__start() { f(); f(); g(); }
+  // g() { f(); }
+  // f() { }
+  goto_modelt goto_model;
+  add_function(goto_model, "f", {});
+  add_function(goto_model, "g", {"f"});
+  add_function(goto_model, goto_functionst::entry_point(), {"f", "f", "g"});
+  goto_model.goto_functions.update();
+
+  null_message_handlert message_handler;
+  ai_summary_interproceduralt ai(
+    util_make_unique<ai_history_factory_default_constructort<ahistoricalt>>(),
+    util_make_unique<
+      ai_domain_factory_default_constructort<return_site_domaint>>(),
+    util_make_unique<location_sensitive_storaget>(),
+    message_handler);
+  ai(goto_model);
+
+  for(const auto &name : {goto_functionst::entry_point(), irep_idt{"g"}})
+  {
+    const goto_programt &body =
+      goto_model.goto_functions.function_map.at(name).body;
+
+    forall_goto_program_instructions(it, body)
+    {
+      if(!it->is_function_call())
+        continue;
+
+      const auto l_return = std::next(it);
+      const auto &state = static_cast<const return_site_domaint &>(
+        *ai.abstract_state_before(l_return));
+
+      REQUIRE_FALSE(state.is_bottom());
+      REQUIRE(
+        state.return_sites ==
+        std::set<unsigned>{static_cast<unsigned>(l_return->location_number)});
+    }
+  }
+}
@@ -0,0 +1,84 @@
+/*******************************************************************\
+
+Module: Unit tests for call_graph_indext
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <analyses/call_graph.h>
+#include <analyses/call_graph_index.h>
+
+SCENARIO(
+  "call_graph_index",
+  "[core][analyses][call_graph][call_graph_index]")
+{
+  GIVEN("A call graph with a cycle and an isolated function")
+  {
+    // main -> A -> B -> A, B -> C, B -> C, main -> D, D -> D, E
+    call_grapht call_graph;
+    call_graph.add("main", "A");
+    call_graph.add("A", "B");
+    call_graph.add("B", "A");
+    call_graph.add("B", "C");
+    call_graph.add("B", "C");
+    call_graph.add("main", "D");
+    call_graph.add("D", "D");
+    call_graph.nodes.insert("E");
+
+    const call_graph_indext index(call_graph);
+
+    THEN("Functions are numbered by name")
+    {
+      REQUIRE(index.size() == 6);
+      REQUIRE(index.get_function(0) == "A");
+      REQUIRE(index.get_function(5) == "main");
+      REQUIRE(*index.find("C") == 2);
+      REQUIRE_FALSE(index.find("F").has_value());
+    }
+
+    THEN("Parallel calls are stored once")
+    {
+      const auto b = *index.find("B");
+      const std::vector<call_graph_indext::function_idt> callees(
+        index.callees(b).begin(), index.callees(b).end());
+      REQUIRE(callees == std::vector<call_graph_indext::function_idt>{0, 2});
+
+      const auto c = *index.find("C");
+      const std::vector<call_graph_indext::function_idt> callers(
+        index.callers(c).begin(), index.callers(c).end());
+      REQUIRE(callers == std::vector<call_graph_indext::function_idt>{1});
+    }
+
+    THEN("Recursion is detected")
+    {
+      REQUIRE(index.number_of_components() == 5);
+      REQUIRE(
+        index.get_component(*index.find("A")) ==
+        index.get_component(*index.find("B")));
+      REQUIRE(index.is_recursive(*index.find("A")));
+      REQUIRE(index.is_recursive(*index.find("D")));
+      REQUIRE_FALSE(index.is_recursive(*index.find("C")));
+      REQUIRE_FALSE(index.is_recursive(*index.find("main")));
+    }
+
+    THEN("Reachability queries are answered")
+    {
+      REQUIRE(index.reaches("main", "C"));
+      REQUIRE(index.reaches("B", "A"));
+      REQUIRE(index.reaches("C", "C"));
+      REQUIRE(index.reaches("main", "D"));
+      REQUIRE_FALSE(index.reaches("C", "B"));
+      REQUIRE_FALSE(index.reaches("D", "A"));
+      REQUIRE_FALSE(index.reaches("main", "E"));
+      REQUIRE_FALSE(index.reaches("main", "F"));
+
+      REQUIRE(
+        index.get_reachable_functions("B") ==
+        std::vector<irep_idt>{"A", "B", "C"});
+      REQUIRE(index.get_reachable_functions("F").empty());
+    }
+  }
+}
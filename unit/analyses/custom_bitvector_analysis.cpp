@@ -0,0 +1,106 @@
+/*******************************************************************\
+
+Module: Unit tests for custom_bitvector_domaint
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <analyses/custom_bitvector_analysis.h>
+
+static custom_bitvector_domaint::vectorst
+make_vectors(unsigned long long may_bits, unsigned long long must_bits)
+{
+  custom_bitvector_domaint::vectorst result;
+  result.may_bits = may_bits;
+  result.must_bits = must_bits;
+  return result;
+}
+
+SCENARIO(
+  "custom_bitvector_domaint::merge",
+  "[core][analyses][custom_bitvector_analysis]")
+{
+  custom_bitvector_domaint a, b;
+  a.make_top();
+  b.make_top();
+
+  GIVEN("two states with the same objects")
+  {
+    a.assign_lhs(irep_idt("x"), make_vectors(1, 3));
+    a.assign_lhs(irep_idt("y"), make_vectors(0, 4));
+    b.assign_lhs(irep_idt("x"), make_vectors(2, 1));
+    b.assign_lhs(irep_idt("y"), make_vectors(0, 4));
+
+    THEN("MAY bits are joined and MUST bits are intersected")
+    {
+      REQUIRE(a.merge(b, nullptr, nullptr));
+      REQUIRE(a.get_rhs(irep_idt("x")).may_bits == 3);
+      REQUIRE(a.get_rhs(irep_idt("x")).must_bits == 1);
+      REQUIRE(a.get_rhs(irep_idt("y")).must_bits == 4);
+      REQUIRE_FALSE(a.merge(b, nullptr, nullptr));
+    }
+  }
+
+  GIVEN("two states with different objects")
+  {
+    a.assign_lhs(irep_idt("x"), make_vectors(0, 1));
+    a.assign_lhs(irep_idt("y"), make_vectors(1, 1));
+    b.assign_lhs(irep_idt("y"), make_vectors(2, 1));
+    b.assign_lhs(irep_idt("z"), make_vectors(4, 4));
+
+    THEN("objects that have no bits left are removed")
+    {
+      REQUIRE(a.merge(b, nullptr, nullptr));
+      REQUIRE(a.objects.size() == 2);
+      REQUIRE(a.get_rhs(irep_idt("x")).must_bits == 0);
+      REQUIRE(a.get_rhs(irep_idt("y")).may_bits == 3);
+      REQUIRE(a.get_rhs(irep_idt("y")).must_bits == 1);
+      REQUIRE(a.get_rhs(irep_idt("z")).may_bits == 4);
+      REQUIRE(a.get_rhs(irep_idt("z")).must_bits == 0);
+      REQUIRE_FALSE(a.merge(b, nullptr, nullptr));
+    }
+  }
+
+  GIVEN("an object that only one of the states tracks")
+  {
+    a.assign_lhs(irep_idt("x"), make_vectors(1, 1));
+    b.assign_lhs(irep_idt("x"), make_vectors(1, 1));
+    b.assign_lhs(irep_idt("z"), make_vectors(4, 4));
+
+    THEN("its MUST bits are dropped when it comes from the other state")
+    {
+      REQUIRE(a.merge(b, nullptr, nullptr));
+      REQUIRE(a.get_rhs(irep_idt("z")).may_bits == 4);
+      REQUIRE(a.get_rhs(irep_idt("z")).must_bits == 0);
+    }
+
+    THEN("its MUST bits are dropped when it is in this state")
+    {
+      REQUIRE(b.merge(a, nullptr, nullptr));
+      REQUIRE(b.get_rhs(irep_idt("z")).may_bits == 4);
+      REQUIRE(b.get_rhs(irep_idt("z")).must_bits == 0);
+    }
+  }
+
+  GIVEN("a bottom state")
+  {
+    custom_bitvector_domaint bottom;
+    b.assign_lhs(irep_idt("x"), make_vectors(1, 1));
+
+    THEN("merging into it copies the other state")
+    {
+      REQUIRE(bottom.merge(b, nullptr, nullptr));
+      REQUIRE(bottom.get_rhs(irep_idt("x")).may_bits == 1);
+      REQUIRE(bottom.get_rhs(irep_idt("x")).must_bits == 1);
+    }
+
+    THEN("merging it changes nothing")
+    {
+      REQUIRE_FALSE(b.merge(bottom, nullptr, nullptr));
+      REQUIRE(b.get_rhs(irep_idt("x")).must_bits == 1);
+    }
+  }
+}
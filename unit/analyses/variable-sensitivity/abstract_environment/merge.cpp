@@ -0,0 +1,140 @@
+/*******************************************************************\
+
+ Module: Tests for abstract_environmentt::merge
+
+ Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <analyses/variable-sensitivity/variable_sensitivity_object_factory.h>
+#include <analyses/variable-sensitivity/variable_sensitivity_test_helpers.h>
+
+#include <goto-programs/goto_program.h>
+
+#include <testing-utils/use_catch.h>
+
+#include <util/arith_tools.h>
+#include <util/bitvector_types.h>
+#include <util/options.h>
+#include <util/symbol_table.h>
+
+SCENARIO(
+  "merging abstract environments shares equal values",
+  "[core][analyses][variable-sensitivity][abstract_environment][merge]")
+{
+  // The default configuration wraps every value in a write location context
+  const auto config = vsd_configt::from_options(optionst{});
+  REQUIRE(config.context_tracking.last_write_context);
+  auto object_factory =
+    variable_sensitivity_object_factoryt::configured_with(config);
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+
+  const signedbv_typet type(32);
+  const symbol_exprt x("x", type);
+  const constant_exprt two = from_integer(2, type);
+  const constant_exprt three = from_integer(3, type);
+
+  goto_programt program;
+  const auto first_assign = program.add(goto_programt::make_assignment(x, two));
+  const auto second_assign =
+    program.add(goto_programt::make_assignment(x, two));
+  program.update();
+
+  // Assign a value to x the way the domain does for an assignment at location
+  const auto assign = [&](
+                        abstract_environmentt &env,
+                        const constant_exprt &value,
+                        goto_programt::const_targett location) {
+    env.assign(x, env.eval(value, ns)->write_location_context(location), ns);
+  };
+
+  GIVEN("two environments that assign x = 2 independently at one location")
+  {
+    auto env1 = abstract_environmentt{object_factory};
+    env1.make_top();
+    assign(env1, two, first_assign);
+
+    auto env2 = abstract_environmentt{object_factory};
+    env2.make_top();
+    assign(env2, two, first_assign);
+
+    THEN("the value of x is the same object")
+    {
+      REQUIRE(env1.eval(x, ns) == env2.eval(x, ns));
+    }
+
+    WHEN("they are merged")
+    {
+      bool modified = env1.merge(
+        env2, goto_programt::const_targett{}, widen_modet::no);
+
+      THEN("the merge is skipped")
+      {
+        REQUIRE_FALSE(modified);
+        const auto statistics = env1.gather_statistics(ns);
+        REQUIRE(statistics.number_of_merges == 1);
+        REQUIRE(statistics.number_of_merge_shortcuts == 1);
+        REQUIRE(statistics.number_of_merge_allocations == 0);
+      }
+    }
+  }
+
+  GIVEN("two environments that assign x = 2 at different locations")
+  {
+    auto env1 = abstract_environmentt{object_factory};
+    env1.make_top();
+    assign(env1, two, first_assign);
+
+    auto env2 = abstract_environmentt{object_factory};
+    env2.make_top();
+    assign(env2, two, second_assign);
+
+    THEN("the values of x are distinct objects")
+    {
+      REQUIRE(env1.eval(x, ns) != env2.eval(x, ns));
+    }
+
+    WHEN("they are merged")
+    {
+      bool modified = env1.merge(
+        env2, goto_programt::const_targett{}, widen_modet::no);
+
+      THEN("the write locations are merged")
+      {
+        REQUIRE(modified);
+        REQUIRE(env1.eval(x, ns)->to_constant() == two);
+        const auto statistics = env1.gather_statistics(ns);
+        REQUIRE(statistics.number_of_merges == 1);
+        REQUIRE(statistics.number_of_merge_shortcuts == 0);
+      }
+    }
+  }
+
+  GIVEN("two environments that assign different values to x")
+  {
+    auto env1 = abstract_environmentt{object_factory};
+    env1.make_top();
+    assign(env1, two, first_assign);
+
+    auto env2 = abstract_environmentt{object_factory};
+    env2.make_top();
+    assign(env2, three, first_assign);
+
+    WHEN("they are merged")
+    {
+      bool modified = env1.merge(
+        env2, goto_programt::const_targett{}, widen_modet::no);
+
+      THEN("the values are merged")
+      {
+        REQUIRE(modified);
+        REQUIRE(env1.eval(x, ns)->is_top());
+        const auto statistics = env1.gather_statistics(ns);
+        REQUIRE(statistics.number_of_merges == 1);
+        REQUIRE(statistics.number_of_merge_shortcuts == 0);
+        REQUIRE(statistics.number_of_merge_allocations == 1);
+      }
+    }
+  }
+}
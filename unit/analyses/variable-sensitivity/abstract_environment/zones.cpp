@@ -0,0 +1,151 @@
+/*******************************************************************\
+
+ Module: Tests for the relations between variables in abstract_environmentt
+
+ Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <analyses/variable-sensitivity/variable_sensitivity_object_factory.h>
+#include <analyses/variable-sensitivity/variable_sensitivity_test_helpers.h>
+
+#include <testing-utils/use_catch.h>
+
+#include <util/arith_tools.h>
+#include <util/bitvector_types.h>
+#include <util/symbol_table.h>
+
+static tvt evaluate(
+  const abstract_environmentt &environment,
+  const exprt &condition,
+  const namespacet &ns)
+{
+  const exprt value = environment.eval(condition, ns)->to_constant();
+  if(value.is_true())
+    return tvt(true);
+  if(value.is_false())
+    return tvt(false);
+  return tvt::unknown();
+}
+
+SCENARIO(
+  "abstract environments track relations between variables",
+  "[core][analyses][variable-sensitivity][abstract_environment][zones]")
+{
+  auto config = vsd_configt::intervals();
+  config.context_tracking.data_dependency_context = false;
+  config.context_tracking.last_write_context = false;
+  config.relations = relationst::zones;
+  auto object_factory =
+    variable_sensitivity_object_factoryt::configured_with(config);
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+
+  const signedbv_typet type(32);
+  const symbol_exprt x("x", type);
+  const symbol_exprt y("y", type);
+  const symbol_exprt z("z", type);
+  const exprt one = from_integer(1, type);
+
+  // x is between 0 and 100
+  auto environment = abstract_environmentt{object_factory};
+  environment.make_top();
+  environment.assign(
+    x,
+    make_interval(from_integer(0, type), from_integer(100, type), environment, ns),
+    ns);
+
+  GIVEN("y = x + 1")
+  {
+    const plus_exprt rhs(x, one);
+    environment.assign(y, rhs, environment.eval(rhs, ns), ns);
+
+    THEN("x < y is known, which the intervals of x and y do not show")
+    {
+      REQUIRE(evaluate(environment, binary_relation_exprt(x, ID_lt, y), ns)
+                .is_true());
+      REQUIRE(evaluate(environment, binary_relation_exprt(y, ID_le, x), ns)
+                .is_false());
+      REQUIRE(evaluate(environment, equal_exprt(y, plus_exprt(x, one)), ns)
+                .is_true());
+    }
+
+    WHEN("x is assigned")
+    {
+      environment.assign(x, make_constant(one, environment, ns), ns);
+
+      THEN("the relation is forgotten")
+      {
+        REQUIRE(evaluate(environment, binary_relation_exprt(x, ID_lt, y), ns)
+                  .is_unknown());
+      }
+    }
+
+    WHEN("y = y + 1")
+    {
+      const plus_exprt increment(y, one);
+      environment.assign(y, increment, environment.eval(increment, ns), ns);
+
+      THEN("the relation is shifted")
+      {
+        REQUIRE(
+          evaluate(
+            environment, equal_exprt(y, plus_exprt(x, from_integer(2, type))), ns)
+            .is_true());
+      }
+    }
+
+    WHEN("it is merged with an environment where y = x + 3")
+    {
+      auto other = abstract_environmentt{object_factory};
+      other.make_top();
+      other.assign(
+        x,
+        make_interval(
+          from_integer(0, type), from_integer(100, type), other, ns),
+        ns);
+      const plus_exprt other_rhs(x, from_integer(3, type));
+      other.assign(y, other_rhs, other.eval(other_rhs, ns), ns);
+
+      goto_programt program;
+      const auto location = program.add(goto_programt::make_skip());
+      program.update();
+
+      REQUIRE(environment.merge(other, location, widen_modet::no));
+
+      THEN("the relation that holds in both is kept")
+      {
+        REQUIRE(evaluate(environment, binary_relation_exprt(x, ID_lt, y), ns)
+                  .is_true());
+        REQUIRE(
+          evaluate(environment, binary_relation_exprt(y, ID_le, x), ns)
+            .is_false());
+        REQUIRE(
+          evaluate(environment, binary_relation_exprt(y, ID_lt, z), ns)
+            .is_unknown());
+      }
+    }
+  }
+
+  GIVEN("the assumption x < z")
+  {
+    REQUIRE_FALSE(environment.is_bottom());
+    environment.assume(binary_relation_exprt(x, ID_lt, z), ns);
+
+    THEN("z > x is known")
+    {
+      REQUIRE(evaluate(environment, binary_relation_exprt(z, ID_gt, x), ns)
+                .is_true());
+    }
+
+    WHEN("z <= x is assumed")
+    {
+      environment.assume(binary_relation_exprt(z, ID_le, x), ns);
+
+      THEN("the environment is bottom")
+      {
+        REQUIRE(environment.is_bottom());
+      }
+    }
+  }
+}
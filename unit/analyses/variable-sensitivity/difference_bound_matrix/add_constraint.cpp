@@ -0,0 +1,97 @@
+/*******************************************************************\
+
+ Module: Tests for difference_bound_matrixt::add_constraint
+
+ Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <analyses/variable-sensitivity/difference_bound_matrix.h>
+
+#include <testing-utils/use_catch.h>
+
+SCENARIO(
+  "adding constraints to a difference bound matrix",
+  "[core][analyses][variable-sensitivity][difference_bound_matrix]")
+{
+  difference_bound_matrixt zone;
+  const std::size_t x = zone.add_variable("x");
+  const std::size_t y = zone.add_variable("y");
+  const std::size_t z = zone.add_variable("z");
+
+  GIVEN("the constraints x - y <= 1 and y - z <= 2")
+  {
+    REQUIRE(zone.add_constraint(x, y, 1));
+    REQUIRE(zone.add_constraint(y, z, 2));
+
+    THEN("x - z <= 3 is implied")
+    {
+      REQUIRE(zone.get(x, z) == 3);
+      REQUIRE(zone.get(z, x) == difference_bound_matrixt::infinity);
+    }
+
+    WHEN("z <= 5 is added")
+    {
+      REQUIRE(zone.add_constraint(z, 0, 5));
+
+      THEN("the upper bounds of x and y follow")
+      {
+        REQUIRE(zone.get(y, 0) == 7);
+        REQUIRE(zone.get(x, 0) == 8);
+      }
+    }
+
+    WHEN("z - x <= -4 is added")
+    {
+      THEN("the constraints are unsatisfiable and the zone is unchanged")
+      {
+        REQUIRE_FALSE(zone.add_constraint(z, x, -4));
+        REQUIRE(zone.get(z, x) == difference_bound_matrixt::infinity);
+      }
+    }
+
+    WHEN("y is removed")
+    {
+      zone.remove_variable(y);
+
+      THEN("the constraint that y implied is kept")
+      {
+        const std::size_t new_x = *zone.index_of("x");
+        const std::size_t new_z = *zone.index_of("z");
+        REQUIRE_FALSE(zone.index_of("y").has_value());
+        REQUIRE(zone.get(new_x, new_z) == 3);
+      }
+    }
+  }
+
+  GIVEN("the bounds 0 <= y <= 10")
+  {
+    REQUIRE(zone.add_constraint(y, 0, 10));
+    REQUIRE(zone.add_constraint(0, y, 0));
+
+    WHEN("x := y + 1 is performed")
+    {
+      zone.assign(x, y, 1);
+
+      THEN("x is related to y")
+      {
+        REQUIRE(zone.get(x, y) == 1);
+        REQUIRE(zone.get(y, x) == -1);
+        REQUIRE(zone.get(x, 0) == 11);
+        REQUIRE(zone.get(0, x) == -1);
+      }
+
+      AND_WHEN("x := x + 2 is performed")
+      {
+        zone.shift(x, 2);
+
+        THEN("the relation to y is shifted")
+        {
+          REQUIRE(zone.get(x, y) == 3);
+          REQUIRE(zone.get(y, x) == -3);
+          REQUIRE(zone.get(x, 0) == 13);
+        }
+      }
+    }
+  }
+}
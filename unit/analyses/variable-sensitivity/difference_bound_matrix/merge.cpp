@@ -0,0 +1,98 @@
+/*******************************************************************\
+
+ Module: Tests for difference_bound_matrixt::join and widen
+
+ Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <analyses/variable-sensitivity/difference_bound_matrix.h>
+
+#include <testing-utils/use_catch.h>
+
+static difference_bound_matrixt
+make_zone(difference_bound_matrixt::boundt x_minus_y, std::size_t upper)
+{
+  difference_bound_matrixt zone;
+  const std::size_t x = zone.add_variable("x");
+  const std::size_t y = zone.add_variable("y");
+  REQUIRE(zone.add_constraint(x, y, x_minus_y));
+  REQUIRE(zone.add_constraint(y, x, -x_minus_y));
+  REQUIRE(zone.add_constraint(y, 0, upper));
+  REQUIRE(zone.add_constraint(0, y, 0));
+  return zone;
+}
+
+SCENARIO(
+  "merging difference bound matrices",
+  "[core][analyses][variable-sensitivity][difference_bound_matrix][merge]")
+{
+  GIVEN("the zones x = y + 1, 0 <= y <= 5 and x = y + 3, 0 <= y <= 10")
+  {
+    difference_bound_matrixt zone = make_zone(1, 5);
+    const difference_bound_matrixt other = make_zone(3, 10);
+    const std::size_t x = *zone.index_of("x");
+    const std::size_t y = *zone.index_of("y");
+
+    WHEN("they are joined")
+    {
+      REQUIRE(zone.join(other));
+
+      THEN("the weaker bound of each difference is kept")
+      {
+        REQUIRE(zone.get(x, y) == 3);
+        REQUIRE(zone.get(y, x) == -1);
+        REQUIRE(zone.get(y, 0) == 10);
+        REQUIRE(zone.get(0, y) == 0);
+        REQUIRE(zone.get_joins() == 1);
+      }
+
+      AND_WHEN("they are joined again")
+      {
+        THEN("nothing changes")
+        {
+          REQUIRE_FALSE(zone.join(other));
+          REQUIRE(zone.get_joins() == 1);
+        }
+      }
+    }
+
+    WHEN("they are widened")
+    {
+      REQUIRE(zone.widen(other));
+      zone.close();
+
+      THEN("the bounds that grew are dropped")
+      {
+        REQUIRE(zone.get(x, y) == difference_bound_matrixt::infinity);
+        REQUIRE(zone.get(y, x) == -1);
+        REQUIRE(zone.get(y, 0) == difference_bound_matrixt::infinity);
+        REQUIRE(zone.get(0, y) == 0);
+      }
+    }
+  }
+
+  GIVEN("zones over different variables")
+  {
+    difference_bound_matrixt zone = make_zone(1, 5);
+    difference_bound_matrixt other;
+    const std::size_t other_y = other.add_variable("y");
+    const std::size_t other_z = other.add_variable("z");
+    REQUIRE(other.add_constraint(other_y, other_z, 0));
+    REQUIRE(other.add_constraint(other_y, 0, 2));
+    REQUIRE(other.add_constraint(0, other_y, 0));
+
+    WHEN("they are joined")
+    {
+      REQUIRE(zone.join(other));
+
+      THEN("only the shared variables are kept")
+      {
+        REQUIRE(zone.get_variables() == std::vector<irep_idt>{"y"});
+        const std::size_t y = *zone.index_of("y");
+        REQUIRE(zone.get(y, 0) == 5);
+        REQUIRE(zone.get(0, y) == 0);
+      }
+    }
+  }
+}
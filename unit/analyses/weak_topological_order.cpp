@@ -0,0 +1,125 @@
+/*******************************************************************\
+
+Module: Unit tests for weak_topological_ordert
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for weak_topological_ordert
+
+#include <testing-utils/use_catch.h>
+
+#include <util/std_expr.h>
+
+#include <analyses/weak_topological_order.h>
+
+#include <sstream>
+
+static std::string
+wto_string(const weak_topological_ordert &wto, const goto_programt &program)
+{
+  std::ostringstream out;
+  wto.output(program, out);
+  return out.str();
+}
+
+SCENARIO(
+  "weak_topological_ordert",
+  "[core][analyses][weak_topological_order]")
+{
+  const symbol_exprt condition("c", bool_typet());
+
+  GIVEN("A program with a loop whose head is not the first instruction")
+  {
+    // 0: SKIP
+    // 1: IF c GOTO 4
+    // 2: SKIP
+    // 3: GOTO 1
+    // 4: END_FUNCTION
+    goto_programt program;
+    program.add(goto_programt::make_skip());
+    auto head = program.add(goto_programt::make_skip());
+    program.add(goto_programt::make_skip());
+    program.add(goto_programt::make_goto(head));
+    auto end = program.add(goto_programt::make_end_function());
+    *head = goto_programt::make_goto(end, condition);
+    program.update();
+
+    weak_topological_ordert wto;
+    wto.add(program);
+
+    THEN("The loop is a component with the condition as its head")
+    {
+      REQUIRE(wto_string(wto, program) == "0 (1 2 3) 4");
+      REQUIRE(wto.is_head(head));
+      REQUIRE_FALSE(wto.is_head(std::next(head)));
+      REQUIRE(wto.depth(head) == 1);
+      REQUIRE(wto.depth(std::next(head)) == 1);
+      REQUIRE(wto.depth(end) == 0);
+      REQUIRE(wto.position(head) < wto.position(end));
+    }
+  }
+
+  GIVEN("A program with nested loops")
+  {
+    // 0: SKIP
+    // 1: IF c GOTO 7
+    // 2: SKIP
+    // 3: IF c GOTO 6
+    // 4: SKIP
+    // 5: GOTO 3
+    // 6: GOTO 1
+    // 7: END_FUNCTION
+    goto_programt program;
+    program.add(goto_programt::make_skip());
+    auto outer = program.add(goto_programt::make_skip());
+    program.add(goto_programt::make_skip());
+    auto inner = program.add(goto_programt::make_skip());
+    program.add(goto_programt::make_skip());
+    program.add(goto_programt::make_goto(inner));
+    auto inner_exit = program.add(goto_programt::make_goto(outer));
+    auto end = program.add(goto_programt::make_end_function());
+    *outer = goto_programt::make_goto(end, condition);
+    *inner = goto_programt::make_goto(inner_exit, condition);
+    program.update();
+
+    weak_topological_ordert wto;
+    wto.add(program);
+
+    THEN("The inner loop is a component nested in the outer one")
+    {
+      REQUIRE(wto_string(wto, program) == "0 (1 2 (3 4 5) 6) 7");
+      REQUIRE(wto.is_head(outer));
+      REQUIRE(wto.is_head(inner));
+      REQUIRE(wto.depth(outer) == 1);
+      REQUIRE(wto.depth(inner) == 2);
+      REQUIRE(wto.depth(inner_exit) == 1);
+    }
+  }
+
+  GIVEN("A program with a self loop and unreachable code")
+  {
+    // 0: SKIP
+    // 1: GOTO 1
+    // 2: END_FUNCTION
+    goto_programt program;
+    program.add(goto_programt::make_skip());
+    auto self_loop = program.add(goto_programt::make_skip());
+    auto end = program.add(goto_programt::make_end_function());
+    *self_loop = goto_programt::make_goto(self_loop, true_exprt());
+    program.update();
+
+    weak_topological_ordert wto;
+    wto.add(program);
+
+    THEN("The self loop is a component and unreachable code comes last")
+    {
+      REQUIRE(wto_string(wto, program) == "0 (1) 2");
+      REQUIRE(wto.is_head(self_loop));
+      REQUIRE_FALSE(wto.is_head(end));
+      REQUIRE(wto.position(end) == 2);
+    }
+  }
+}
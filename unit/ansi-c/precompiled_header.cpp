@@ -0,0 +1,120 @@
+/*******************************************************************\
+
+Module: Unit tests for precompiled headers
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/bitvector_types.h>
+#include <util/tempfile.h>
+
+#include <ansi-c/precompiled_header.h>
+
+static std::string preprocessed(const std::string &main_file)
+{
+  return "# 1 \"" + main_file +
+         "\"\n"
+         "# 1 \"<built-in>\"\n"
+         "# 1 \"<command-line>\"\n"
+         "# 1 \"" +
+         main_file +
+         "\"\n"
+         "# 1 \"header.h\" 1\n"
+         "typedef int number;\n"
+         "\n"
+         "number f(void);\n"
+         "# 2 \"" +
+         main_file +
+         "\" 2\n"
+         "\n"
+         "\n"
+         "int main() { return f(); }\n"
+         "# 1 \"other.h\" 1\n"
+         "int g(void);\n";
+}
+
+TEST_CASE(
+  "Splitting preprocessed text into headers and the rest",
+  "[core][ansi-c][precompiled_header]")
+{
+  const auto main = split_precompiled_header(preprocessed("main.c"));
+  const auto other = split_precompiled_header(preprocessed("other.c"));
+  REQUIRE(main.has_value());
+  REQUIRE(other.has_value());
+
+  SECTION("The headers do not depend on the main file")
+  {
+    REQUIRE(main->first == other->first);
+    REQUIRE(
+      main->first == "# 1 \"<built-in>\"\n"
+                     "# 1 \"<command-line>\"\n"
+                     "# 1 \"header.h\" 1\n"
+                     "typedef int number;\n"
+                     "\n"
+                     "number f(void);\n");
+  }
+
+  SECTION("The rest starts at the first declaration of the main file")
+  {
+    REQUIRE(
+      main->second == "# 4 \"main.c\"\n"
+                      "int main() { return f(); }\n"
+                      "# 1 \"other.h\" 1\n"
+                      "int g(void);\n");
+  }
+
+  SECTION("Text that does not start with a header is not split")
+  {
+    REQUIRE_FALSE(
+      split_precompiled_header("# 1 \"main.c\"\nint main() {}\n").has_value());
+  }
+}
+
+TEST_CASE(
+  "Precompiled headers can be read back",
+  "[core][ansi-c][precompiled_header]")
+{
+  precompiled_headert header;
+  header.key = "Aa";
+  header.names["number"].id_class = ansi_c_id_classt::ANSI_C_TYPEDEF;
+  header.names["number"].base_name = "number";
+  header.names["number"].prefixed_name = "number";
+  header.asm_labels["f"] = "f_renamed";
+
+  symbolt symbol;
+  symbol.name = "number";
+  symbol.base_name = "number";
+  symbol.mode = ID_C;
+  symbol.is_type = true;
+  symbol.type = signedbv_typet{32};
+  header.symbol_table.add(symbol);
+
+  temporary_filet file("precompiled_header", ".pch");
+  REQUIRE_FALSE(header.write(file()));
+
+  SECTION("A precompiled header with another key is not read")
+  {
+    precompiled_headert result;
+    result.key = "BB";
+    REQUIRE(result.read(file()));
+    REQUIRE(result.names.empty());
+    REQUIRE(result.symbol_table.symbols.empty());
+  }
+
+  precompiled_headert result;
+  result.key = header.key;
+  REQUIRE_FALSE(result.read(file()));
+
+  REQUIRE(result.names.size() == 1);
+  const ansi_c_identifiert &identifier = result.names.at("number");
+  const bool is_typedef =
+    identifier.id_class == ansi_c_id_classt::ANSI_C_TYPEDEF;
+  REQUIRE(is_typedef);
+  REQUIRE(identifier.base_name == "number");
+  REQUIRE(identifier.prefixed_name == "number");
+  REQUIRE(result.asm_labels == header.asm_labels);
+  REQUIRE(result.symbol_table == header.symbol_table);
+}
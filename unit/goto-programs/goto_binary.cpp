@@ -0,0 +1,211 @@
+/*******************************************************************\
+
+Module: Unit tests for writing and reading goto binaries
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/arith_tools.h>
+#include <util/bitvector_types.h>
+#include <util/message.h>
+#include <util/tempfile.h>
+
+#include <goto-programs/goto_model.h>
+#include <goto-programs/read_bin_goto_object.h>
+#include <goto-programs/write_goto_binary.h>
+
+#include <fstream>
+#include <sstream>
+
+static void add_function(
+  goto_modelt &goto_model,
+  const irep_idt &name,
+  const optionalt<irep_idt> &callee)
+{
+  const code_typet type({}, empty_typet());
+
+  symbolt symbol;
+  symbol.name = name;
+  symbol.base_name = name;
+  symbol.mode = ID_C;
+  symbol.type = type;
+  goto_model.symbol_table.add(symbol);
+
+  goto_programt &body = goto_model.goto_functions.function_map[name].body;
+  if(callee.has_value())
+  {
+    body.add(
+      goto_programt::make_function_call(code_function_callt{
+        symbol_exprt{*callee, type}}));
+  }
+  const symbol_exprt x{"x", signedbv_typet{32}};
+  auto loop = body.add(
+    goto_programt::make_assignment(x, from_integer(1, x.type())));
+  body.add(goto_programt::make_goto(loop, equal_exprt{x, x}));
+  body.add(goto_programt::make_end_function());
+  body.update();
+}
+
+static void require_same_body(
+  const goto_modelt &expected,
+  const goto_modelt &actual,
+  const irep_idt &name)
+{
+  const goto_programt &expected_body =
+    expected.goto_functions.function_map.at(name).body;
+  const goto_programt &actual_body =
+    actual.goto_functions.function_map.at(name).body;
+
+  REQUIRE(
+    actual_body.instructions.size() == expected_body.instructions.size());
+
+  auto actual_it = actual_body.instructions.begin();
+  for(const auto &instruction : expected_body.instructions)
+  {
+    REQUIRE(actual_it->type() == instruction.type());
+    REQUIRE(actual_it->code() == instruction.code());
+    if(instruction.is_goto())
+    {
+      REQUIRE(actual_it->targets.size() == 1);
+      REQUIRE(
+        actual_it->get_target()->code() == instruction.get_target()->code());
+    }
+    ++actual_it;
+  }
+}
+
+SCENARIO("goto binaries can be read back", "[core][goto-programs][goto_binary]")
+{
+  goto_modelt goto_model;
+  add_function(goto_model, "main", irep_idt{"f"});
+  add_function(goto_model, "f", {});
+  add_function(goto_model, "unused", irep_idt{"f"});
+
+  null_message_handlert message_handler;
+
+  for(const int version :
+      {GOTO_BINARY_UNINDEXED_VERSION, GOTO_BINARY_VERSION})
+  {
+    GIVEN("A goto binary of version " + std::to_string(version))
+    {
+      std::stringstream binary;
+      REQUIRE_FALSE(write_goto_binary(binary, goto_model, version));
+
+      THEN("All functions are read")
+      {
+        goto_modelt result;
+        REQUIRE_FALSE(read_bin_goto_object(
+          binary,
+          "",
+          result.symbol_table,
+          result.goto_functions,
+          message_handler));
+
+        REQUIRE(result.symbol_table.symbols.size() == 3);
+        for(const irep_idt name : {"main", "f", "unused"})
+          require_same_body(goto_model, result, name);
+      }
+    }
+  }
+
+  GIVEN("A compressed goto binary")
+  {
+    std::stringstream binary;
+    REQUIRE_FALSE(write_compressed_goto_binary(binary, goto_model));
+
+    THEN("All functions are read")
+    {
+      goto_modelt result;
+      REQUIRE_FALSE(read_bin_goto_object(
+        binary,
+        "",
+        result.symbol_table,
+        result.goto_functions,
+        message_handler));
+
+      REQUIRE(result.symbol_table.symbols.size() == 3);
+      for(const irep_idt name : {"main", "f", "unused"})
+        require_same_body(goto_model, result, name);
+    }
+
+    THEN("It is smaller than the uncompressed goto binary")
+    {
+      std::stringstream uncompressed;
+      REQUIRE_FALSE(write_goto_binary(uncompressed, goto_model));
+      REQUIRE(binary.str().size() < uncompressed.str().size());
+    }
+
+    THEN("A truncated compressed goto binary is rejected")
+    {
+      std::istringstream truncated(binary.str().substr(0, 8));
+
+      goto_modelt result;
+      REQUIRE(read_bin_goto_object(
+        truncated,
+        "",
+        result.symbol_table,
+        result.goto_functions,
+        message_handler));
+    }
+  }
+
+  GIVEN("A goto binary with an index of its functions")
+  {
+    temporary_filet file("goto_binary", ".gb");
+    {
+      std::ofstream out(file(), std::ios::binary);
+      REQUIRE_FALSE(write_goto_binary(out, goto_model));
+    }
+
+    REQUIRE(lazy_goto_binary_readert::is_indexed(file()));
+
+    goto_modelt result;
+    lazy_goto_binary_readert reader(message_handler);
+    REQUIRE_FALSE(
+      reader.read(file(), result.symbol_table, result.goto_functions));
+
+    THEN("Only the symbol table is read at first")
+    {
+      REQUIRE(result.symbol_table.symbols.size() == 3);
+      REQUIRE(result.goto_functions.function_map.size() == 3);
+      for(const auto &entry : result.goto_functions.function_map)
+      {
+        REQUIRE_FALSE(entry.second.body_available());
+        REQUIRE(reader.has_unread_body(entry.first));
+      }
+    }
+
+    THEN("The bodies of reachable functions are read on demand")
+    {
+      reader.read_reachable_bodies("main", result.goto_functions);
+
+      require_same_body(goto_model, result, "main");
+      require_same_body(goto_model, result, "f");
+      REQUIRE_FALSE(reader.has_unread_body("f"));
+      REQUIRE_FALSE(
+        result.goto_functions.function_map.at("unused").body_available());
+      REQUIRE(reader.has_unread_body("unused"));
+
+      reader.read_body("unused", result.goto_functions);
+      require_same_body(goto_model, result, "unused");
+    }
+  }
+
+  GIVEN("A goto binary without an index of its functions")
+  {
+    temporary_filet file("goto_binary", ".gb");
+    {
+      std::ofstream out(file(), std::ios::binary);
+      REQUIRE_FALSE(
+        write_goto_binary(out, goto_model, GOTO_BINARY_UNINDEXED_VERSION));
+    }
+
+    THEN("It cannot be read on demand")
+    {
+      REQUIRE_FALSE(lazy_goto_binary_readert::is_indexed(file()));
+    }
+  }
+}
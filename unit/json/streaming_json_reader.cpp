@@ -0,0 +1,98 @@
+/*******************************************************************\
+
+Module: Unit tests for the streaming JSON reader
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <util/exception_utils.h>
+
+#include <json/json_parser.h>
+#include <json/streaming_json_reader.h>
+
+#include <sstream>
+
+static std::string to_string(const jsont &json)
+{
+  std::ostringstream out;
+  json.output(out);
+  return out.str();
+}
+
+SCENARIO("Reading JSON values one at a time", "[core][json][streaming]")
+{
+  const std::string document =
+    "{\n"
+    "  \"first\": [1, -2.5e+3, 0, true, false, null],\n"
+    "  \"second\": {\"a\": \"x\\\"y\\\\z\\n\\u00e9\", \"b\": []},\n"
+    "  \"third\": {}\n"
+    "}\n";
+
+  GIVEN("A JSON document")
+  {
+    THEN("Reading it as a whole gives the same value as the parser")
+    {
+      std::istringstream in(document);
+      streaming_json_readert reader(in, "test.json");
+      const jsont value = reader.read_value();
+      reader.end();
+
+      std::istringstream parser_in(document);
+      jsont expected;
+      REQUIRE_FALSE(
+        parse_json(parser_in, "test.json", null_message_handler, expected));
+      REQUIRE(to_string(value) == to_string(expected));
+    }
+
+    THEN("Its members can be read and skipped one at a time")
+    {
+      std::istringstream in(document);
+      streaming_json_readert reader(in, "test.json");
+      REQUIRE(reader.peek_kind() == jsont::kindt::J_OBJECT);
+      reader.begin_object();
+
+      REQUIRE(reader.next_key() == std::string("first"));
+      reader.skip_value();
+
+      REQUIRE(reader.next_key() == std::string("second"));
+      reader.begin_object();
+      REQUIRE(reader.next_key() == std::string("a"));
+      REQUIRE(reader.read_value().value == "x\"y\\z\n\xc3\xa9");
+      REQUIRE(reader.next_key() == std::string("b"));
+      REQUIRE(reader.peek_kind() == jsont::kindt::J_ARRAY);
+      reader.skip_value();
+      REQUIRE_FALSE(reader.next_key().has_value());
+
+      REQUIRE(reader.next_key() == std::string("third"));
+      REQUIRE(reader.read_value().is_object());
+      REQUIRE_FALSE(reader.next_key().has_value());
+      reader.end();
+    }
+  }
+
+  GIVEN("Malformed JSON documents")
+  {
+    for(const std::string malformed :
+        {"{\"a\" 1}",
+         "{\"a\": 1,}",
+         "[1 2]",
+         "01",
+         "\"abc",
+         "\"\\q\"",
+         "tru",
+         "{\"a\": 1} x"})
+    {
+      THEN("Reading `" + malformed + "' fails")
+      {
+        std::istringstream in(malformed);
+        streaming_json_readert reader(in, "test.json");
+        REQUIRE_THROWS_AS(
+          (reader.read_value(), reader.end()), deserialization_exceptiont);
+      }
+    }
+  }
+}
@@ -82,4 +82,19 @@ TEST_CASE("json symbol table read/write consistency")
   // Finally check if symbol tables are consistent
 
   REQUIRE(symbol_table1 == symbol_table2);
+
+  // Read the json symbol table again, one symbol at a time
+  symbol_tablet symbol_table3;
+  {
+    std::istringstream in(out.str());
+    jsont json;
+    REQUIRE(!parse_json(in, "", null_message_handler, json));
+    std::ostringstream json_symbol_table;
+    to_json_array(json).begin()->output(json_symbol_table);
+
+    std::istringstream symbol_table_in(json_symbol_table.str());
+    symbol_table_from_json(symbol_table_in, "", symbol_table3);
+  }
+
+  REQUIRE(symbol_table1 == symbol_table3);
 }
@@ -30,6 +30,9 @@ Author: Michael Tautschnig
 
 #define INCLUDED_VIA_USE_CATCH_H
 
+// Benchmarks are hidden test cases tagged [benchmark]
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+
 #include <catch/catch.hpp>
 
 #ifdef _MSC_VER
@@ -0,0 +1,45 @@
+/*******************************************************************\
+
+Module: Unit tests for keys of cache entries
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/cache_key.h>
+
+#include <sstream>
+
+TEST_CASE("Keys of cache entries", "[core][util][cache_key]")
+{
+  std::ostringstream out;
+  write_cache_key(out, "Aa");
+  out << "entry";
+
+  SECTION("The key that was written is read back")
+  {
+    std::istringstream in(out.str());
+    REQUIRE_FALSE(read_cache_key(in, "Aa"));
+
+    std::string entry;
+    in >> entry;
+    REQUIRE(entry == "entry");
+  }
+
+  SECTION("Other keys are rejected")
+  {
+    for(const std::string key : {"BB", "A", "Aaa", ""})
+    {
+      std::istringstream in(out.str());
+      REQUIRE(read_cache_key(in, key));
+    }
+  }
+
+  SECTION("Truncated keys are rejected")
+  {
+    std::istringstream in(out.str().substr(0, 2));
+    REQUIRE(read_cache_key(in, "Aa"));
+  }
+}
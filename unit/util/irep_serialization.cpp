@@ -0,0 +1,120 @@
+/*******************************************************************\
+
+Module: Unit tests for irep_serializationt
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/arith_tools.h>
+#include <util/bitvector_types.h>
+#include <util/exception_utils.h>
+#include <util/irep_serialization.h>
+#include <util/std_expr.h>
+
+#include <limits>
+#include <sstream>
+
+/// \return an expression of \p size assignments that resembles the body of
+///   a function, in which every assignment is to a distinct symbol
+static irept make_program(std::size_t size)
+{
+  const signedbv_typet type{32};
+
+  irept program("program");
+  for(std::size_t i = 0; i < size; ++i)
+  {
+    const symbol_exprt lhs("main::x" + std::to_string(i), type);
+    const symbol_exprt rhs("main::y" + std::to_string(i % 100), type);
+    program.get_sub().push_back(
+      equal_exprt{lhs, plus_exprt{rhs, from_integer(i, type)}});
+  }
+
+  return program;
+}
+
+static std::string write(const irept &irep)
+{
+  std::ostringstream out;
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt irep_serialization(ireps_container);
+  irep_serialization.reference_convert(irep, out);
+  return out.str();
+}
+
+static irept read(const std::string &serialized)
+{
+  std::istringstream in(serialized);
+  irep_serializationt::ireps_containert ireps_container;
+  irep_serializationt irep_serialization(ireps_container);
+  return irep_serialization.reference_convert(in);
+}
+
+TEST_CASE("Serializing ireps", "[core][util][irep_serialization]")
+{
+  SECTION("Ireps can be read back")
+  {
+    const irept program = make_program(1000);
+    REQUIRE(read(write(program)) == program);
+  }
+
+  SECTION("Strings with special characters can be read back")
+  {
+    const std::string special("a\\b\0c\\\\", 7);
+    std::ostringstream out;
+    write_gb_string(out, special);
+    write_gb_string(out, "");
+
+    std::istringstream in(out.str());
+    irep_serializationt::ireps_containert ireps_container;
+    irep_serializationt irep_serialization(ireps_container);
+    REQUIRE(irep_serialization.read_gb_string(in) == special);
+    REQUIRE(irep_serialization.read_gb_string(in).empty());
+  }
+
+  SECTION("Numbers can be read back")
+  {
+    const std::size_t numbers[] = {
+      0, 1, 127, 128, 300, std::numeric_limits<std::size_t>::max()};
+    std::ostringstream out;
+    for(const std::size_t number : numbers)
+      write_gb_word(out, number);
+
+    std::istringstream in(out.str());
+    for(const std::size_t number : numbers)
+      REQUIRE(irep_serializationt::read_gb_word(in) == number);
+  }
+
+  SECTION("Truncated input is rejected")
+  {
+    const std::string serialized = write(make_program(10));
+    for(const std::size_t size : {std::size_t{0},
+                                  std::size_t{1},
+                                  serialized.size() / 2,
+                                  serialized.size() - 1})
+    {
+      REQUIRE_THROWS_AS(
+        read(serialized.substr(0, size)), deserialization_exceptiont);
+    }
+  }
+}
+
+TEST_CASE(
+  "Throughput of serializing ireps",
+  "[.][benchmark][util][irep_serialization]")
+{
+  const irept program = make_program(100000);
+  const std::string serialized = write(program);
+
+  BENCHMARK("Writing " + std::to_string(serialized.size()) + " bytes")
+  {
+    return write(program).size();
+  };
+
+  BENCHMARK("Reading " + std::to_string(serialized.size()) + " bytes")
+  {
+    return read(serialized).get_sub().size();
+  };
+}
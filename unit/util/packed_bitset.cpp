@@ -0,0 +1,110 @@
+/*******************************************************************\
+
+Module: Unit tests for packed_bitsett
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+#include <util/packed_bitset.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+static std::vector<std::size_t> elements(const packed_bitsett &s)
+{
+  return std::vector<std::size_t>(s.begin(), s.end());
+}
+
+static std::vector<std::size_t> elements(const std::set<std::size_t> &s)
+{
+  return std::vector<std::size_t>(s.begin(), s.end());
+}
+
+TEST_CASE("packed_bitsett basic operations", "[core][util][packed_bitset]")
+{
+  packed_bitsett s;
+  REQUIRE(s.empty());
+  REQUIRE(s.begin() == s.end());
+
+  REQUIRE(s.insert(3));
+  REQUIRE(s.insert(64));
+  REQUIRE(s.insert(1000));
+  REQUIRE_FALSE(s.insert(64));
+
+  REQUIRE(s.size() == 3);
+  REQUIRE(s.contains(3));
+  REQUIRE(s.contains(1000));
+  REQUIRE_FALSE(s.contains(4));
+  REQUIRE(elements(s) == std::vector<std::size_t>{3, 64, 1000});
+
+  REQUIRE(s.erase(64));
+  REQUIRE_FALSE(s.erase(64));
+  REQUIRE(elements(s) == std::vector<std::size_t>{3, 1000});
+
+  packed_bitsett t;
+  t.insert(3);
+  t.insert(63);
+  REQUIRE(s.insert(t));
+  REQUIRE_FALSE(s.insert(t));
+  REQUIRE(elements(s) == std::vector<std::size_t>{3, 63, 1000});
+
+  REQUIRE(s.erase(t));
+  REQUIRE_FALSE(s.erase(t));
+  REQUIRE(elements(s) == std::vector<std::size_t>{1000});
+
+  s.clear();
+  REQUIRE(s.empty());
+  REQUIRE(s == packed_bitsett());
+}
+
+TEST_CASE(
+  "packed_bitsett behaves like std::set",
+  "[core][util][packed_bitset]")
+{
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<std::size_t> value(0, 500);
+  std::uniform_int_distribution<int> operation(0, 3);
+
+  packed_bitsett a, b;
+  std::set<std::size_t> a_reference, b_reference;
+
+  for(int i = 0; i < 2000; ++i)
+  {
+    const std::size_t v = value(generator);
+
+    switch(operation(generator))
+    {
+    case 0:
+      REQUIRE(a.insert(v) == a_reference.insert(v).second);
+      break;
+    case 1:
+      REQUIRE(b.insert(v) == b_reference.insert(v).second);
+      break;
+    case 2:
+      REQUIRE(a.erase(v) == (a_reference.erase(v) != 0));
+      break;
+    default:
+    {
+      const std::size_t size_before = a_reference.size();
+      if(v % 2 == 0)
+      {
+        a_reference.insert(b_reference.begin(), b_reference.end());
+        REQUIRE(a.insert(b) == (a_reference.size() != size_before));
+      }
+      else
+      {
+        for(const auto &e : b_reference)
+          a_reference.erase(e);
+        REQUIRE(a.erase(b) == (a_reference.size() != size_before));
+      }
+    }
+    }
+
+    REQUIRE(elements(a) == elements(a_reference));
+    REQUIRE(elements(b) == elements(b_reference));
+    REQUIRE(a.size() == a_reference.size());
+  }
+}